@@ -0,0 +1,482 @@
+// Host benchmark for the rendering and decoding modules (env:native).
+//
+//   pio run -e native && .pio/build/native/program [iterations-scale]
+//
+// Every benchmark prints one line:
+//   BENCH <name> iters=<n> total_ms=<t> per_iter_us=<u> [mb_s=<x>|ns_px=<x>] allocs=<a> alloc_bytes=<b>
+// so runs can be diffed or collected by a script. Allocation counts are
+// per iteration and cover operator new plus (on glibc) malloc.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <LittleFS.h>
+#include <zlib.h>
+#include <chrono>
+#include <new>
+#include <vector>
+#include "serial_config.h"
+#include "canvas.h"
+#include "qr_code.h"
+#include "display_handler.h"
+#include "frame_arena.h"
+#include "config_manager.h"
+#include "frame_decoder.h"
+#include "frame_store.h"
+#include "delta_patcher.h"
+#include "color_quantizer.h"
+#include "weather_overlay.h"
+#include "rtc_state.h"
+
+// --- Allocation counting ------------------------------------------------
+
+static size_t allocCount = 0;
+static size_t allocBytes = 0;
+
+#ifdef __GLIBC__
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* ptr, size_t size);
+extern "C" void __libc_free(void* ptr);
+
+extern "C" void* malloc(size_t size) {
+    allocCount++;
+    allocBytes += size;
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+    allocCount++;
+    allocBytes += count * size;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+    allocCount++;
+    allocBytes += size;
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void* ptr) {
+    __libc_free(ptr);
+}
+
+// new goes through malloc, which already counts it
+void* operator new(size_t size) {
+    void* ptr = malloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+#else
+void* operator new(size_t size) {
+    allocCount++;
+    allocBytes += size;
+    void* ptr = malloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+#endif
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+// --- Runner -------------------------------------------------------------
+
+static int iterationScale = 1;
+
+enum Unit { UNIT_NONE, UNIT_MB_S, UNIT_NS_PX };
+
+// Runs body once untimed to warm caches and lazy state, then iters times
+template <typename Body>
+static void bench(const char* name, int iters, Unit unit, double workPerIter, Body body) {
+    iters *= iterationScale;
+    Serial1.muted = true;
+    body();
+
+    size_t startCount = allocCount;
+    size_t startBytes = allocBytes;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iters; i++) {
+        body();
+    }
+    auto end = std::chrono::steady_clock::now();
+    size_t count = allocCount - startCount;
+    size_t bytes = allocBytes - startBytes;
+    Serial1.muted = false;
+
+    double totalNs = std::chrono::duration<double, std::nano>(end - start).count();
+    double perIterNs = totalNs / iters;
+    printf("BENCH %-24s iters=%d total_ms=%.2f per_iter_us=%.2f", name, iters, totalNs / 1e6, perIterNs / 1e3);
+    if (unit == UNIT_MB_S) {
+        printf(" mb_s=%.1f", workPerIter / perIterNs * 1e3);
+    } else if (unit == UNIT_NS_PX) {
+        printf(" ns_px=%.2f", perIterNs / workPerIter);
+    }
+    printf(" allocs=%zu alloc_bytes=%zu\n", count / iters, bytes / iters);
+}
+
+// Swallows a frame, keeping only what a test needs to know
+class NullSink : public FrameSink {
+public:
+    size_t received = 0;
+    bool committed = false;
+
+    bool beginFrame(size_t) override { received = 0; return true; }
+    bool writeFrame(const uint8_t*, size_t length) override { received += length; return true; }
+    bool endFrame(bool commit) override { committed = commit; return commit; }
+};
+
+// Reads every byte it is handed, as the panel path would. Sinks fed by
+// pointer pass-through would otherwise time nothing but the loop.
+class ChecksumSink : public NullSink {
+public:
+    uint32_t checksum = 0;
+
+    bool writeFrame(const uint8_t* data, size_t length) override {
+        uint32_t total = checksum;
+        for (size_t i = 0; i < length; i++) total += data[i];
+        checksum = total;
+        received += length;
+        return true;
+    }
+};
+
+// Feeds a buffer in network-sized pieces
+static bool streamTo(FrameSink& sink, const std::vector<uint8_t>& data, size_t chunk = 1460) {
+    if (!sink.beginFrame(data.size())) return false;
+    bool ok = true;
+    for (size_t pos = 0; pos < data.size() && ok; pos += chunk) {
+        ok = sink.writeFrame(data.data() + pos, min(chunk, data.size() - pos));
+    }
+    return sink.endFrame(ok);
+}
+
+// --- Test data ----------------------------------------------------------
+
+// Deterministic stand-in for a rendered dashboard: flat panels with text
+// and a dithered gradient band, so RLE and zlib see realistic runs
+static std::vector<uint8_t> makeFrame(uint32_t seed) {
+    std::vector<uint8_t> frame(DISPLAY_FRAME_SIZE);
+    Canvas canvas(frame.data());
+    canvas.fill(EPD_7IN3F_WHITE);
+    canvas.fillRect(0, 0, DISPLAY_WIDTH, 60, EPD_7IN3F_BLUE);
+    canvas.drawText("Smart Dashboard", 20, 15, 4, EPD_7IN3F_WHITE);
+    for (int i = 0; i < 12; i++) {
+        canvas.fillRect(20 + (i % 4) * 190, 80 + (i / 4) * 100, 180, 90, (i + seed) % 7);
+        canvas.drawText("12:34 21C", 30 + (i % 4) * 190, 110 + (i / 4) * 100, 2, EPD_7IN3F_BLACK);
+    }
+
+    uint32_t state = seed * 2654435761u + 1;
+    for (int y = 390; y < DISPLAY_HEIGHT; y++) {
+        for (int x = 0; x < DISPLAY_WIDTH; x++) {
+            state = state * 1664525u + 1013904223u;
+            canvas.setPixel(x, y, ((x * 7 / DISPLAY_WIDTH) + (state >> 30)) % 7);
+        }
+    }
+    return frame;
+}
+
+static std::vector<uint8_t> makeContainer(const std::vector<uint8_t>& raw, const std::vector<uint8_t>& payload,
+                                          uint8_t codec, uint8_t flags) {
+    FrameHeader header;
+    header.magic = FRAME_MAGIC;
+    header.version = FRAME_VERSION;
+    header.codec = codec;
+    header.pixelFormat = FRAME_PIXEL_4BPP;
+    header.flags = flags;
+    header.width = DISPLAY_WIDTH;
+    header.height = DISPLAY_HEIGHT;
+    header.rawSize = raw.size();
+    header.payloadSize = payload.size();
+    header.crc32 = frameCrc32(0, raw.data(), raw.size());
+
+    std::vector<uint8_t> container((const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+    container.insert(container.end(), payload.begin(), payload.end());
+    return container;
+}
+
+// Same scheme as Server/utils/frame_codec.py
+static std::vector<uint8_t> encodeRle(const std::vector<uint8_t>& raw) {
+    std::vector<uint8_t> out;
+    size_t pos = 0;
+    size_t literalStart = 0;
+
+    auto flushLiterals = [&](size_t end) {
+        while (literalStart < end) {
+            size_t count = min((size_t)128, end - literalStart);
+            out.push_back(count - 1);
+            out.insert(out.end(), raw.begin() + literalStart, raw.begin() + literalStart + count);
+            literalStart += count;
+        }
+    };
+
+    while (pos < raw.size()) {
+        size_t run = 1;
+        while (pos + run < raw.size() && raw[pos + run] == raw[pos] && run < 0x7F + FRAME_RLE_MIN_RUN) run++;
+        if (run >= FRAME_RLE_MIN_RUN) {
+            flushLiterals(pos);
+            out.push_back(0x80 | (run - FRAME_RLE_MIN_RUN));
+            out.push_back(raw[pos]);
+            pos += run;
+            literalStart = pos;
+        } else {
+            pos += run;
+        }
+    }
+    flushLiterals(pos);
+    return out;
+}
+
+static std::vector<uint8_t> encodeZlib(const std::vector<uint8_t>& raw) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    deflateInit2(&stream, 9, Z_DEFLATED, 12, 9, Z_DEFAULT_STRATEGY);  // 4 KB window
+
+    std::vector<uint8_t> out(deflateBound(&stream, raw.size()));
+    stream.next_in = (Bytef*)raw.data();
+    stream.avail_in = raw.size();
+    stream.next_out = out.data();
+    stream.avail_out = out.size();
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+// A delta patch touching a few widgets, as a clock and weather update would
+static std::vector<uint8_t> makeDelta(const std::vector<uint8_t>& base, std::vector<uint8_t>& target) {
+    target = base;
+    const FrameDeltaRect rects[] = { { 20, 80, 180, 90 }, { 400, 180, 180, 90 }, { 0, 400, 800, 40 } };
+
+    std::vector<uint8_t> payload(sizeof(FrameDeltaHeader));
+    for (const FrameDeltaRect& rect : rects) {
+        payload.insert(payload.end(), (const uint8_t*)&rect, (const uint8_t*)&rect + sizeof(rect));
+        for (int y = rect.y; y < rect.y + rect.height; y++) {
+            uint8_t* row = target.data() + y * DISPLAY_ROW_BYTES + rect.x / 2;
+            for (int i = 0; i < rect.width / 2; i++) {
+                row[i] = (row[i] + 0x11 * (1 + (y & 1))) & 0x66;
+            }
+            payload.insert(payload.end(), row, row + rect.width / 2);
+        }
+    }
+
+    FrameDeltaHeader header;
+    header.magic = FRAME_DELTA_MAGIC;
+    header.baseCrc = frameCrc32(0, base.data(), base.size());
+    header.targetCrc = frameCrc32(0, target.data(), target.size());
+    header.rectCount = sizeof(rects) / sizeof(rects[0]);
+    header.reserved = 0;
+    memcpy(payload.data(), &header, sizeof(header));
+    return payload;
+}
+
+// --- Benchmarks ---------------------------------------------------------
+
+static void benchCanvas() {
+    std::vector<uint8_t> buffer(DISPLAY_FRAME_SIZE);
+    Canvas canvas(buffer.data());
+    double pixels = (double)DISPLAY_WIDTH * DISPLAY_HEIGHT;
+
+    bench("canvas_fill", 200, UNIT_NS_PX, pixels, [&] {
+        canvas.fill(EPD_7IN3F_WHITE);
+    });
+    bench("canvas_fill_rect", 200, UNIT_NS_PX, (double)701 * 399, [&] {
+        canvas.fillRect(49, 40, 701, 399, EPD_7IN3F_RED);  // Odd edges take the nibble path
+    });
+
+    const char* line = "1. Scan QR code to connect to WiFi";
+    double textPixels = (double)Canvas::textWidth(line, 2) * 7 * 2;
+    bench("canvas_text_x2", 2000, UNIT_NS_PX, textPixels, [&] {
+        canvas.drawText(line, 10, 100, 2, EPD_7IN3F_BLACK);
+    });
+}
+
+static void benchQr() {
+    static uint8_t qrData[QR_MAX_MODULES];
+    int qrSize = QRCode::generateWiFiQR(AP_SSID, AP_PASSWORD, qrData);
+    std::vector<uint8_t> buffer(DISPLAY_FRAME_SIZE);
+    Canvas canvas(buffer.data());
+
+    bench("qr_generate", 500, UNIT_NONE, 0, [&] {
+        QRCode::generateWiFiQR(AP_SSID, AP_PASSWORD, qrData);
+    });
+    bench("qr_draw_x7", 1000, UNIT_NS_PX, (double)qrSize * qrSize * 49, [&] {
+        QRCode::convertToEPaperFormat(qrData, qrSize, canvas, DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 2 - 20, 7);
+    });
+}
+
+static void benchDisplay(FrameArena& arena, const std::vector<uint8_t>& frame) {
+    DisplayHandler display;
+    display.setFrameArena(&arena);
+    display.initialize();
+
+    SPI.resetCounters();
+    mockDelayedMs = 0;
+    streamTo(display, frame);
+    printf("INFO display_stream spi_bytes=%llu spi_transfers=%llu panel_delay_ms=%lu\n",
+           (unsigned long long)SPI.bytes, (unsigned long long)SPI.transfers, mockDelayedMs);
+
+    bench("display_stream", 200, UNIT_MB_S, frame.size(), [&] {
+        streamTo(display, frame);
+    });
+
+    SPI.resetCounters();
+    display.showConfigurationQR();
+    printf("INFO display_qr_screen spi_bytes=%llu spi_transfers=%llu\n",
+           (unsigned long long)SPI.bytes, (unsigned long long)SPI.transfers);
+
+    bench("display_qr_screen", 100, UNIT_MB_S, DISPLAY_FRAME_SIZE, [&] {
+        display.showConfigurationQR();
+    });
+}
+
+static void benchConfig() {
+    ConfigManager config;
+    config.init();
+    config.setWiFiCredentials("HomeNetwork-5G", "correct horse battery staple");
+    config.setGitHubInfo("octocat/dashboard-frames", "images/living_room");
+    config.setConfigured(true);
+
+    String json = config.getConfigJson();
+    bench("config_to_json", 20000, UNIT_NONE, 0, [&] {
+        String out = config.getConfigJson();
+    });
+    bench("config_from_json", 200, UNIT_NONE, 0, [&] {
+        config.setConfigFromJson(json);  // Includes the NVS save
+    });
+}
+
+static void benchDecoder(const std::vector<uint8_t>& frame) {
+    FrameDecoder decoder;
+    ChecksumSink sink;
+    decoder.setOutput(&sink);
+
+    std::vector<uint8_t> raw = makeContainer(frame, frame, FRAME_CODEC_RAW, 0);
+    std::vector<uint8_t> rle = makeContainer(frame, encodeRle(frame), FRAME_CODEC_RLE, 0);
+    std::vector<uint8_t> zlib = makeContainer(frame, encodeZlib(frame), FRAME_CODEC_ZLIB, 0);
+    printf("INFO frame_sizes raw=%zu rle=%zu zlib=%zu\n", raw.size(), rle.size(), zlib.size());
+
+    const struct { const char* name; const std::vector<uint8_t>* container; } cases[] = {
+        { "decode_raw", &raw }, { "decode_rle", &rle }, { "decode_zlib", &zlib }
+    };
+    for (const auto& entry : cases) {
+        if (!streamTo(decoder, *entry.container) || sink.received != frame.size()) {
+            printf("INFO %s rejected the synthetic frame\n", entry.name);
+            continue;
+        }
+        bench(entry.name, 200, UNIT_MB_S, frame.size(), [&] {
+            streamTo(decoder, *entry.container);
+        });
+    }
+}
+
+static void benchDelta(const std::vector<uint8_t>& frame) {
+    FrameStore store;
+    NullSink sink;
+    store.setOutput(&sink);
+    store.begin(false);
+
+    FrameDecoder decoder;
+    DeltaPatcher patcher;
+    decoder.setOutput(&store);
+    decoder.setDeltaOutput(&patcher);
+    patcher.setBase(&store);
+    patcher.setOutput(&store);
+
+    std::vector<uint8_t> target;
+    std::vector<uint8_t> payload = makeDelta(frame, target);
+    std::vector<uint8_t> forward = makeContainer(payload, encodeZlib(payload), FRAME_CODEC_ZLIB, FRAME_FLAG_DELTA);
+
+    // The store becomes the patched frame, so each patch re-records the base
+    std::vector<uint8_t> baseContainer = makeContainer(frame, frame, FRAME_CODEC_RAW, 0);
+    printf("INFO delta_size payload=%zu container=%zu\n", payload.size(), forward.size());
+
+    bench("store_record_raw", 50, UNIT_MB_S, frame.size(), [&] {
+        streamTo(decoder, baseContainer);
+    });
+    bench("delta_patch_zlib", 50, UNIT_MB_S, frame.size(), [&] {
+        streamTo(decoder, baseContainer);   // Base for the patch, not part of the result
+        streamTo(decoder, forward);
+    });
+    printf("INFO delta_patch_zlib committed=%d (time includes recording the base)\n", sink.committed);
+}
+
+static void benchQuantizer() {
+    ColorQuantizer quantizer;
+    NullSink sink;
+    quantizer.setOutput(&sink);
+
+    std::vector<uint8_t> rgb((size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * 3);
+    for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+        for (int x = 0; x < DISPLAY_WIDTH; x++) {
+            uint8_t* pixel = rgb.data() + ((size_t)y * DISPLAY_WIDTH + x) * 3;
+            pixel[0] = x * 255 / DISPLAY_WIDTH;
+            pixel[1] = y * 255 / DISPLAY_HEIGHT;
+            pixel[2] = (x + y) & 0xFF;
+        }
+    }
+
+    std::vector<uint8_t> rgb565((size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT * 2);
+    for (size_t i = 0; i < (size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT; i++) {
+        const uint8_t* pixel = rgb.data() + i * 3;
+        uint16_t value = ((pixel[0] >> 3) << 11) | ((pixel[1] >> 2) << 5) | (pixel[2] >> 3);
+        rgb565[i * 2] = value & 0xFF;
+        rgb565[i * 2 + 1] = value >> 8;
+    }
+
+    double pixels = (double)DISPLAY_WIDTH * DISPLAY_HEIGHT;
+    bench("quantize_rgb888", 50, UNIT_NS_PX, pixels, [&] {
+        streamTo(quantizer, rgb);
+    });
+    bench("quantize_rgb565", 50, UNIT_NS_PX, pixels, [&] {
+        streamTo(quantizer, rgb565);
+    });
+}
+
+static void benchOverlay(const std::vector<uint8_t>& frame) {
+    WeatherOverlay overlay;
+    ChecksumSink sink;
+    overlay.setOutput(&sink);
+
+    WeatherData weather;
+    memset(&weather, 0, sizeof(weather));
+    weather.baseCrc = frameCrc32(0, frame.data(), frame.size());
+    weather.utcOffset = 3600;
+    weather.hasWeather = true;
+    weather.temperature = -12;
+    strcpy(weather.icon, "10d");
+
+    time_t now = 1760000000;
+    bench("overlay_render", 2000, UNIT_NONE, 0, [&] {
+        overlay.render(weather, now);
+    });
+    bench("overlay_stream", 200, UNIT_MB_S, frame.size(), [&] {
+        streamTo(overlay, frame);
+    });
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        iterationScale = max(1, atoi(argv[1]));
+    }
+
+    rtcStateReset();
+    LittleFS.begin(true);
+
+    FrameArena arena;
+    arena.begin();
+
+    std::vector<uint8_t> frame = makeFrame(1);
+
+    benchCanvas();
+    benchQr();
+    benchDisplay(arena, frame);
+    benchConfig();
+    benchDecoder(frame);
+    benchDelta(frame);
+    benchQuantizer();
+    benchOverlay(frame);
+    return 0;
+}
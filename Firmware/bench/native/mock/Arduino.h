@@ -0,0 +1,98 @@
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+// Just enough of the Arduino-ESP32 core to build the rendering and decoding
+// modules on the host (env:native). Timing comes from the host clock; pins,
+// interrupts and sleep are no-ops with the BUSY line always idle, and
+// delay() returns at once after adding to mockDelayedMs.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+#define HIGH    1
+#define LOW     0
+#define INPUT   0
+#define OUTPUT  1
+#define RISING  1
+#define MSBFIRST 1
+
+#define PROGMEM
+#define PGM_P const char*
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+using std::min;
+using std::max;
+
+// std::string underneath; covers what the modules and ArduinoJson use
+class String {
+public:
+    String() {}
+    String(const char* text) { if (text) value = text; }
+    String(const std::string& text) : value(text) {}
+    String(int number) : value(std::to_string(number)) {}
+    String(unsigned int number) : value(std::to_string(number)) {}
+    String(long number) : value(std::to_string(number)) {}
+    String(unsigned long number) : value(std::to_string(number)) {}
+    
+    String& operator=(const char* text) { value = text ? text : ""; return *this; }
+    String& operator+=(const String& other) { value += other.value; return *this; }
+    String& operator+=(const char* text) { if (text) value += text; return *this; }
+    String& operator+=(char c) { value += c; return *this; }
+    bool concat(const char* text) { if (text) value += text; return true; }
+    bool concat(char c) { value += c; return true; }
+    
+    const char* c_str() const { return value.c_str(); }
+    unsigned int length() const { return value.size(); }
+    char operator[](unsigned int index) const { return value[index]; }
+    bool operator==(const String& other) const { return value == other.value; }
+    bool operator!=(const String& other) const { return value != other.value; }
+    bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    bool endsWith(const String& suffix) const {
+        return value.size() >= suffix.value.size() &&
+               value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+    }
+    String substring(unsigned int from, unsigned int to) const { return String(value.substr(from, to - from)); }
+    long toInt() const { return strtol(value.c_str(), nullptr, 10); }
+    
+private:
+    std::string value;
+};
+
+inline String operator+(const String& a, const String& b) { String s(a); s += b; return s; }
+inline String operator+(const String& a, const char* b) { String s(a); s += b; return s; }
+inline String operator+(const char* a, const String& b) { String s(a); s += b; return s; }
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+extern unsigned long mockDelayedMs;
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void detachInterrupt(uint8_t pin);
+#define digitalPinToInterrupt(pin) (pin)
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 0; }
+};
+extern EspClass ESP;
+
+#include "HardwareSerial.h"
+
+// One console on the host, whether or not serial_config.h was included
+#ifndef Serial
+#define Serial Serial1
+#endif
+
+#endif // MOCK_ARDUINO_H
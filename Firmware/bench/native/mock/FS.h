@@ -0,0 +1,54 @@
+#ifndef MOCK_FS_H
+#define MOCK_FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+#define FILE_READ  "r"
+#define FILE_WRITE "w"
+
+namespace fs {
+
+typedef std::shared_ptr<std::vector<uint8_t>> FileData;
+
+// A file is a shared byte vector plus a position; writes truncate on open
+class File {
+public:
+    File() : position(0) {}
+    explicit File(FileData data) : data(data), position(0) {}
+    
+    operator bool() const { return (bool)data; }
+    size_t size() const { return data ? data->size() : 0; }
+    bool seek(size_t offset) {
+        if (!data || offset > data->size()) return false;
+        position = offset;
+        return true;
+    }
+    size_t read(uint8_t* buffer, size_t length);
+    size_t write(const uint8_t* buffer, size_t length);
+    void flush() {}
+    void close() { data.reset(); }
+    
+private:
+    FileData data;
+    size_t position;
+};
+
+class FS {
+public:
+    File open(const char* path, const char* mode = FILE_READ);
+    bool exists(const char* path) const { return files.count(path) > 0; }
+    bool remove(const char* path) { return files.erase(path) > 0; }
+    bool rename(const char* from, const char* to);
+    
+protected:
+    std::map<std::string, FileData> files;
+};
+
+} // namespace fs
+
+using fs::File;
+
+#endif // MOCK_FS_H
@@ -0,0 +1,39 @@
+#ifndef MOCK_HARDWARE_SERIAL_H
+#define MOCK_HARDWARE_SERIAL_H
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#define SERIAL_8N1 0x800001c
+
+// Log output goes to stdout unless muted; the benchmark runner mutes it
+// around timed loops so printf cost does not count against the kernels
+class HardwareSerial {
+public:
+    bool muted = false;
+    
+    void begin(unsigned long, uint32_t = SERIAL_8N1, int8_t = -1, int8_t = -1) {}
+    void flush() { fflush(stdout); }
+    
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        if (muted) return 0;
+        va_list args;
+        va_start(args, format);
+        int written = vprintf(format, args);
+        va_end(args);
+        return written > 0 ? written : 0;
+    }
+    size_t write(const uint8_t* data, size_t length) { return muted ? 0 : fwrite(data, 1, length, stdout); }
+    int availableForWrite() { return 128; }  // TX FIFO size
+    template <typename T> size_t println(const T& text) { return muted ? 0 : ::printf("%s\n", cstr(text)); }
+    size_t println() { return muted ? 0 : ::printf("\n"); }
+    
+private:
+    static const char* cstr(const char* text) { return text; }
+    template <typename T> static const char* cstr(const T& text) { return text.c_str(); }
+};
+
+extern HardwareSerial Serial1;
+
+#endif // MOCK_HARDWARE_SERIAL_H
@@ -0,0 +1,27 @@
+#ifndef MOCK_PREFERENCES_H
+#define MOCK_PREFERENCES_H
+
+#include <Arduino.h>
+
+// In-memory NVS: namespaces live for the life of the process
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partition = nullptr);
+    void end() { space.clear(); }
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+    
+    size_t putBytes(const char* key, const void* value, size_t length);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+    size_t getBytesLength(const char* key);
+    size_t putString(const char* key, const String& value);
+    String getString(const char* key, const String& defaultValue = String());
+    size_t putUInt(const char* key, uint32_t value);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+    
+private:
+    std::string space;
+};
+
+#endif // MOCK_PREFERENCES_H
@@ -0,0 +1,49 @@
+#ifndef MOCK_SPI_H
+#define MOCK_SPI_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SPI_MODE0 0
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = 1, uint8_t dataMode = 0) : clock(clock) {
+        (void)bitOrder;
+        (void)dataMode;
+    }
+    uint32_t clock;
+};
+
+// Counts what would have gone over the wire instead of sending it. Every
+// byte is read into a checksum, as the FIFO fill would, so throughput
+// figures for the display path measure real work.
+class SPIClass {
+public:
+    uint64_t bytes = 0;        // Every byte clocked out
+    uint64_t transfers = 0;    // Calls into the driver (per-byte vs bulk)
+    uint32_t checksum = 0;     // Sink for the data; keeps the reads alive
+    
+    void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data) { checksum += data; bytes++; transfers++; return 0; }
+    void writeBytes(const uint8_t* data, uint32_t size) { sum(data, size); bytes += size; transfers++; }
+    void writePattern(const uint8_t* data, uint8_t size, uint32_t repeat) {
+        for (uint32_t i = 0; i < repeat; i++) sum(data, size);
+        bytes += (uint64_t)size * repeat;
+        transfers++;
+    }
+    void resetCounters() { bytes = 0; transfers = 0; }
+    
+private:
+    void sum(const uint8_t* data, uint32_t size) {
+        uint32_t total = checksum;
+        for (uint32_t i = 0; i < size; i++) total += data[i];
+        checksum = total;
+    }
+};
+
+extern SPIClass SPI;
+
+#endif // MOCK_SPI_H
@@ -0,0 +1,14 @@
+#ifndef DEFAULT_CONFIG_H
+#define DEFAULT_CONFIG_H
+
+// No compiled-in credentials on the host; the benchmark sets its own
+#define DEFAULT_WIFI_SSID     ""
+#define DEFAULT_WIFI_PASSWORD ""
+#define DEFAULT_GITHUB_REPO   ""
+#define DEFAULT_GITHUB_PATH   ""
+#define HAS_DEFAULT_WIFI      0
+#define HAS_DEFAULT_GITHUB    0
+#define SHOW_DEFAULT_CONFIG   0
+#define FORCE_DEFAULT_CONFIG  0
+
+#endif // DEFAULT_CONFIG_H
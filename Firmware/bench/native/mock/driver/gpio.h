@@ -0,0 +1,12 @@
+#ifndef MOCK_GPIO_H
+#define MOCK_GPIO_H
+
+typedef int gpio_num_t;
+typedef int esp_err_t;
+
+#define GPIO_INTR_HIGH_LEVEL 5
+
+inline esp_err_t gpio_wakeup_enable(gpio_num_t, int) { return 0; }
+inline esp_err_t gpio_wakeup_disable(gpio_num_t) { return 0; }
+
+#endif // MOCK_GPIO_H
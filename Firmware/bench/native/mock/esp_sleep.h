@@ -0,0 +1,17 @@
+#ifndef MOCK_ESP_SLEEP_H
+#define MOCK_ESP_SLEEP_H
+
+#include <stdint.h>
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED = 0,
+    ESP_SLEEP_WAKEUP_TIMER = 4,
+    ESP_SLEEP_WAKEUP_GPIO = 7
+} esp_sleep_source_t;
+
+inline int esp_sleep_enable_gpio_wakeup() { return 0; }
+inline int esp_sleep_enable_timer_wakeup(uint64_t) { return 0; }
+inline int esp_sleep_disable_wakeup_source(esp_sleep_source_t) { return 0; }
+inline int esp_light_sleep_start() { return 0; }
+
+#endif // MOCK_ESP_SLEEP_H
@@ -0,0 +1,21 @@
+#ifndef MOCK_SEMPHR_H
+#define MOCK_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+// Single-threaded host: a binary semaphore is a flag
+typedef struct MockSemaphore { int count; } *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new MockSemaphore{0}; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t) {
+    if (s->count == 0) return pdFALSE;
+    s->count = 0;
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t* woken) {
+    s->count = 1;
+    if (woken) *woken = pdFALSE;
+    return pdTRUE;
+}
+
+#endif // MOCK_SEMPHR_H
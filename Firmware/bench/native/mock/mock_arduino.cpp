@@ -0,0 +1,189 @@
+// Host implementations behind the env:native mocks
+#include <Arduino.h>
+#include <SPI.h>
+#include <Preferences.h>
+#include <LittleFS.h>
+#include "esp32/rom/miniz.h"
+#include <chrono>
+#include <map>
+#include <vector>
+
+HardwareSerial Serial1;
+SPIClass SPI;
+EspClass ESP;
+LittleFSFS LittleFS;
+
+static const auto startTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+}
+
+// Panel reset and power sequencing would dominate every timing, so delays
+// are only added up; the runner reports the total separately
+unsigned long mockDelayedMs = 0;
+
+void delay(unsigned long ms) {
+    mockDelayedMs += ms;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }  // BUSY is never asserted
+void attachInterrupt(uint8_t, void (*)(void), int) {}
+void detachInterrupt(uint8_t) {}
+
+// --- Preferences --------------------------------------------------------
+
+static std::map<std::string, std::vector<uint8_t>> nvsStore;
+
+bool Preferences::begin(const char* name, bool readOnly, const char*) {
+    std::string prefix = std::string(name) + "/";
+
+    // Read-only opens fail for namespaces that were never written, like NVS
+    if (readOnly) {
+        auto it = nvsStore.lower_bound(prefix);
+        if (it == nvsStore.end() || it->first.compare(0, prefix.size(), prefix) != 0) {
+            return false;
+        }
+    }
+    space = prefix;
+    return true;
+}
+
+bool Preferences::clear() {
+    for (auto it = nvsStore.lower_bound(space);
+         it != nvsStore.end() && it->first.compare(0, space.size(), space) == 0;) {
+        it = nvsStore.erase(it);
+    }
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    return nvsStore.erase(space + key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    return nvsStore.count(space + key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    const uint8_t* bytes = (const uint8_t*)value;
+    nvsStore[space + key].assign(bytes, bytes + length);
+    return length;
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+    auto it = nvsStore.find(space + key);
+    if (it == nvsStore.end() || it->second.size() > maxLength) return 0;
+    memcpy(buffer, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    auto it = nvsStore.find(space + key);
+    return it == nvsStore.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::putString(const char* key, const String& value) {
+    return putBytes(key, value.c_str(), value.length() + 1);
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    auto it = nvsStore.find(space + key);
+    return it == nvsStore.end() ? defaultValue : String((const char*)it->second.data());
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value) {
+    return putBytes(key, &value, sizeof(value));
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+    uint32_t value = defaultValue;
+    return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+}
+
+// --- LittleFS -----------------------------------------------------------
+
+namespace fs {
+
+size_t File::read(uint8_t* buffer, size_t length) {
+    if (!data) return 0;
+    size_t count = min(length, data->size() - position);
+    memcpy(buffer, data->data() + position, count);
+    position += count;
+    return count;
+}
+
+size_t File::write(const uint8_t* buffer, size_t length) {
+    if (!data) return 0;
+    if (position + length > data->size()) {
+        data->resize(position + length);
+    }
+    memcpy(data->data() + position, buffer, length);
+    position += length;
+    return length;
+}
+
+File FS::open(const char* path, const char* mode) {
+    if (strcmp(mode, FILE_WRITE) == 0) {
+        FileData data = std::make_shared<std::vector<uint8_t>>();
+        files[path] = data;
+        return File(data);
+    }
+    auto it = files.find(path);
+    return it == files.end() ? File() : File(it->second);
+}
+
+bool FS::rename(const char* from, const char* to) {
+    auto it = files.find(from);
+    if (it == files.end()) return false;
+    files[to] = it->second;
+    files.erase(it);
+    return true;
+}
+
+} // namespace fs
+
+// --- ROM inflater -------------------------------------------------------
+
+#define TINFL_MOCK_COOKIE 0x5A4C4942  // "ZLIB"
+
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* pIn_buf_next, size_t* pIn_buf_size,
+                              mz_uint8* pOut_buf_start, mz_uint8* pOut_buf_next, size_t* pOut_buf_size,
+                              const mz_uint32 decomp_flags) {
+    (void)pOut_buf_start;
+    int windowBits = (decomp_flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15;
+
+    if (r->m_state == 0) {
+        if (r->cookie == TINFL_MOCK_COOKIE) {
+            inflateReset2(&r->stream, windowBits);
+        } else {
+            memset(&r->stream, 0, sizeof(r->stream));
+            if (inflateInit2(&r->stream, windowBits) != Z_OK) return TINFL_STATUS_FAILED;
+            r->cookie = TINFL_MOCK_COOKIE;
+        }
+        r->m_state = 1;
+    }
+
+    z_stream& stream = r->stream;
+    stream.next_in = (Bytef*)pIn_buf_next;
+    stream.avail_in = *pIn_buf_size;
+    stream.next_out = pOut_buf_next;
+    stream.avail_out = *pOut_buf_size;
+
+    int result = inflate(&stream, Z_NO_FLUSH);
+    *pIn_buf_size -= stream.avail_in;
+    *pOut_buf_size -= stream.avail_out;
+
+    if (result == Z_STREAM_END) return TINFL_STATUS_DONE;
+    if (result != Z_OK && result != Z_BUF_ERROR) return TINFL_STATUS_FAILED;
+    if (stream.avail_out == 0) return TINFL_STATUS_HAS_MORE_OUTPUT;
+    return (decomp_flags & TINFL_FLAG_HAS_MORE_INPUT) ? TINFL_STATUS_NEEDS_MORE_INPUT : TINFL_STATUS_FAILED;
+}
@@ -0,0 +1,426 @@
+// On-target benchmark firmware (env:bench). Replaces main.cpp, runs the
+// suite once after reset and prints a report on the serial console:
+//
+//   pio run -e bench -t upload && pio device monitor -e bench
+//
+// Result lines are "BENCH <name> key=value ...", memory snapshots are
+// "MEM <phase> key=value ...", and the report is framed by BENCH_BEGIN and
+// BENCH_END so a script can cut it out of the log. WiFi and the GitHub
+// source come from the configuration stored in NVS; without one the
+// network benchmarks are skipped. The panel RAM is written but never
+// refreshed, so the screen keeps its image.
+
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "config.h"
+#include "config_manager.h"
+#include "epd7in3f.h"
+#include "canvas.h"
+#include "frame_arena.h"
+#include "frame_decoder.h"
+#include "frame_format.h"
+#include "github_fetcher.h"
+#include "rtc_state.h"
+
+#define BENCH_PER_BYTE_BYTES    16384   // Per-byte writes toggle CS for every byte - keep it short
+#define BENCH_WIFI_ROUNDS       3
+#define BENCH_TLS_ROUNDS        3
+#define BENCH_DOWNLOAD_ROUNDS   3
+#define BENCH_DECODE_ROUNDS     5
+#define BENCH_READ_TIMEOUT_MS   10000
+
+// The 80 MHz APB clock divides down to these exactly
+static const uint32_t SPI_BENCH_CLOCKS[] = { 4000000, 10000000, 20000000, 40000000 };
+
+ConfigManager configManager;
+FrameArena frameArena;
+EPD7in3f epd;
+GitHubImageFetcher imageFetcher(&configManager);
+
+// Counts decoded bytes and throws them away
+class CountingSink : public FrameSink {
+public:
+    size_t received = 0;
+    bool committed = false;
+
+    bool beginFrame(size_t) override { received = 0; committed = false; return true; }
+    bool writeFrame(const uint8_t*, size_t length) override { received += length; return true; }
+    bool endFrame(bool commit) override { committed = commit; return commit; }
+};
+
+static CountingSink countingSink;
+static FrameDecoder frameDecoder;
+
+static float megabytesPerSecond(size_t bytes, uint32_t micros) {
+    return micros > 0 ? (float)bytes / micros : 0.0f;
+}
+
+static void reportMemory(const char* phase) {
+    Serial.printf("MEM %s heap_free=%u heap_min=%u heap_largest=%u psram_free=%u psram_min=%u stack_hwm=%u\n",
+                  phase,
+                  heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                  heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+                  heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL),
+                  heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+                  heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM),
+                  uxTaskGetStackHighWaterMark(nullptr));
+}
+
+static void benchSpi(const uint8_t* frame) {
+    epd.init();
+
+    for (uint32_t clock : SPI_BENCH_CLOCKS) {
+        epd.setSpiClock(clock);
+
+        // Each path writes panel RAM from the start; nothing is refreshed
+        epd.startFrameTransfer();
+        uint32_t start = micros();
+        for (size_t i = 0; i < BENCH_PER_BYTE_BYTES; i++) {
+            epd.sendData(frame[i]);
+        }
+        uint32_t elapsed = micros() - start;
+        Serial.printf("BENCH spi_per_byte clock_hz=%u bytes=%u us=%u mb_s=%.3f\n",
+                      clock, BENCH_PER_BYTE_BYTES, elapsed, megabytesPerSecond(BENCH_PER_BYTE_BYTES, elapsed));
+
+        epd.startFrameTransfer();
+        start = micros();
+        epd.sendDataBlock(frame, DISPLAY_FRAME_SIZE);
+        elapsed = micros() - start;
+        Serial.printf("BENCH spi_bulk clock_hz=%u bytes=%u us=%u mb_s=%.3f\n",
+                      clock, DISPLAY_FRAME_SIZE, elapsed, megabytesPerSecond(DISPLAY_FRAME_SIZE, elapsed));
+
+        epd.startFrameTransfer();
+        start = micros();
+        epd.sendDataRepeat(0x11, DISPLAY_FRAME_SIZE);
+        elapsed = micros() - start;
+        Serial.printf("BENCH spi_pattern clock_hz=%u bytes=%u us=%u mb_s=%.3f\n",
+                      clock, DISPLAY_FRAME_SIZE, elapsed, megabytesPerSecond(DISPLAY_FRAME_SIZE, elapsed));
+    }
+
+    epd.setSpiClock(EPD_SPI_CLOCK_HZ);
+    epd.sleep();
+}
+
+static bool waitForConnection(unsigned long timeoutMs) {
+    unsigned long start = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - start < timeoutMs) {
+        delay(WIFI_POLL_INTERVAL_MS);
+    }
+    return WiFi.status() == WL_CONNECTED;
+}
+
+static bool benchWiFi() {
+    const char* ssid = configManager.getWiFiSSID();
+    const char* password = configManager.getWiFiPassword();
+    WiFi.persistent(false);
+    WiFi.mode(WIFI_STA);
+
+    uint8_t bssid[6];
+    int32_t channel = 0;
+    bool connected = false;
+
+    // Full scan and DHCP, then the cached BSSID/channel path main.cpp uses on wakeups
+    for (int round = 0; round < BENCH_WIFI_ROUNDS * 2; round++) {
+        bool cached = round >= BENCH_WIFI_ROUNDS;
+        if (cached && channel == 0) break;
+
+        WiFi.disconnect();
+        delay(500);
+
+        uint32_t start = millis();
+        if (cached) {
+            WiFi.begin(ssid, password, channel, bssid);
+        } else {
+            WiFi.begin(ssid, password);
+        }
+        connected = waitForConnection(cached ? WIFI_FAST_CONNECT_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS);
+        uint32_t elapsed = millis() - start;
+
+        Serial.printf("BENCH wifi_connect mode=%s round=%d ok=%d ms=%u rssi=%d channel=%d\n",
+                      cached ? "cached" : "scan", round % BENCH_WIFI_ROUNDS, connected, elapsed,
+                      connected ? WiFi.RSSI() : 0, connected ? WiFi.channel() : 0);
+
+        if (connected && channel == 0) {
+            memcpy(bssid, WiFi.BSSID(), sizeof(bssid));
+            channel = WiFi.channel();
+        }
+    }
+
+    // The remaining benchmarks need a connection, whichever path got it
+    if (!connected) {
+        WiFi.begin(ssid, password);
+        connected = waitForConnection(WIFI_CONNECT_TIMEOUT_MS);
+    }
+    return connected;
+}
+
+// WiFiClientSecure does not expose mbedTLS session tickets, so "resumed"
+// here is what the fetcher does instead: further requests over the
+// kept-alive connection, compared with a fresh handshake per request
+static void benchTls(const char* url) {
+    WiFiClientSecure client;
+    client.setInsecure();
+
+    for (int round = 0; round < BENCH_TLS_ROUNDS; round++) {
+        uint32_t start = millis();
+        bool ok = client.connect(GITHUB_HOST, GITHUB_PORT);
+        uint32_t elapsed = millis() - start;
+        client.stop();
+        Serial.printf("BENCH tls_handshake mode=full round=%d ok=%d ms=%u\n", round, ok, elapsed);
+    }
+
+    HTTPClient http;
+    http.setReuse(true);
+    for (int round = 0; round <= BENCH_TLS_ROUNDS; round++) {
+        // Round 0 opens the connection, the rest should reuse it
+        bool reused = client.connected();
+        uint32_t start = millis();
+        http.begin(client, url);
+        int code = http.sendRequest("HEAD");
+        uint32_t elapsed = millis() - start;
+        http.end();
+        Serial.printf("BENCH tls_request mode=%s round=%d code=%d ms=%u\n",
+                      reused ? "reused" : "new", round, code, elapsed);
+    }
+    client.stop();
+}
+
+// Reads the published container into buffer; returns its length, 0 on failure
+static size_t benchHttpsRead(const char* url, uint8_t* buffer, size_t capacity) {
+    WiFiClientSecure client;
+    client.setInsecure();
+    HTTPClient http;
+
+    uint32_t start = millis();
+    http.begin(client, url);
+    int code = http.GET();
+    int size = http.getSize();
+    uint32_t firstByte = millis() - start;
+    if (code != HTTP_CODE_OK || size <= 0 || (size_t)size > capacity) {
+        Serial.printf("BENCH https_read ok=0 code=%d size=%d capacity=%u\n", code, size, capacity);
+        http.end();
+        return 0;
+    }
+
+    WiFiClient* stream = http.getStreamPtr();
+    size_t total = 0;
+    uint32_t readStart = micros();
+    unsigned long lastData = millis();
+    while (total < (size_t)size && millis() - lastData < BENCH_READ_TIMEOUT_MS) {
+        int available = stream->available();
+        if (available <= 0) {
+            delay(1);
+            continue;
+        }
+        int bytesRead = stream->readBytes(buffer + total, min((size_t)available, (size_t)size - total));
+        if (bytesRead > 0) {
+            total += bytesRead;
+            lastData = millis();
+        }
+    }
+    uint32_t elapsed = micros() - readStart;
+    http.end();
+
+    Serial.printf("BENCH https_read ok=%d bytes=%u ttfb_ms=%u us=%u mb_s=%.3f\n",
+                  total == (size_t)size, total, firstByte, elapsed, megabytesPerSecond(total, elapsed));
+    return total == (size_t)size ? total : 0;
+}
+
+static void benchFetcher() {
+    for (int round = 0; round < BENCH_DOWNLOAD_ROUNDS; round++) {
+        // Without a cleared validator the server would answer 304
+        imageFetcher.clearETag();
+
+        uint32_t start = millis();
+        FetchResult result = imageFetcher.streamLatestImage(&countingSink);
+        uint32_t elapsed = millis() - start;
+        Serial.printf("BENCH fetch_stream round=%d result=%d code=%d decoded=%u ms=%u mb_s=%.3f\n",
+                      round, result, imageFetcher.getLastHttpCode(), countingSink.received, elapsed,
+                      megabytesPerSecond(countingSink.received, elapsed * 1000));
+    }
+    imageFetcher.endSession();
+}
+
+static void benchDecode(const char* name, const uint8_t* data, size_t length) {
+    uint32_t best = UINT32_MAX;
+    uint32_t total = 0;
+
+    for (int round = 0; round < BENCH_DECODE_ROUNDS; round++) {
+        uint32_t start = micros();
+        frameDecoder.beginFrame(length);
+        bool ok = true;
+        for (size_t pos = 0; pos < length && ok; pos += STREAM_CHUNK_SIZE) {
+            ok = frameDecoder.writeFrame(data + pos, min((size_t)STREAM_CHUNK_SIZE, length - pos));
+        }
+        frameDecoder.endFrame(ok);
+        uint32_t elapsed = micros() - start;
+
+        if (!countingSink.committed) {
+            Serial.printf("BENCH %s ok=0\n", name);
+            return;
+        }
+        best = min(best, elapsed);
+        total += elapsed;
+    }
+
+    Serial.printf("BENCH %s ok=1 input=%u output=%u best_us=%u avg_us=%u mb_s=%.3f\n",
+                  name, length, countingSink.received, best, total / BENCH_DECODE_ROUNDS,
+                  megabytesPerSecond(countingSink.received, best));
+}
+
+// Flat panels and a noisy band, roughly what the server publishes
+static void drawTestFrame(uint8_t* frame) {
+    Canvas canvas(frame);
+    canvas.fill(EPD_7IN3F_WHITE);
+    canvas.fillRect(0, 0, DISPLAY_WIDTH, 60, EPD_7IN3F_BLUE);
+    canvas.drawText("Smart Dashboard", 20, 15, 4, EPD_7IN3F_WHITE);
+    for (int i = 0; i < 12; i++) {
+        canvas.fillRect(20 + (i % 4) * 190, 80 + (i / 4) * 100, 180, 90, i % 7);
+    }
+
+    uint32_t state = 1;
+    for (int y = 390; y < DISPLAY_HEIGHT; y++) {
+        for (int x = 0; x < DISPLAY_WIDTH; x++) {
+            state = state * 1664525u + 1013904223u;
+            canvas.setPixel(x, y, (x * 7 / DISPLAY_WIDTH + (state >> 30)) % 7);
+        }
+    }
+}
+
+static bool appendLiterals(const uint8_t* data, size_t count, uint8_t* out, size_t& length, size_t capacity) {
+    while (count > 0) {
+        size_t take = min((size_t)128, count);
+        if (length + 1 + take > capacity) return false;
+        out[length++] = take - 1;
+        memcpy(out + length, data, take);
+        length += take;
+        data += take;
+        count -= take;
+    }
+    return true;
+}
+
+// RLE container of frame built in out (same scheme as frame_codec.py);
+// returns its length, 0 if it does not fit
+static size_t buildRleContainer(const uint8_t* frame, uint8_t* out, size_t capacity) {
+    size_t length = FRAME_HEADER_SIZE;
+    size_t pos = 0;
+    size_t literalStart = 0;
+
+    while (pos < DISPLAY_FRAME_SIZE) {
+        size_t run = 1;
+        while (pos + run < DISPLAY_FRAME_SIZE && frame[pos + run] == frame[pos] &&
+               run < 0x7F + FRAME_RLE_MIN_RUN) {
+            run++;
+        }
+
+        if (run >= FRAME_RLE_MIN_RUN) {
+            if (!appendLiterals(frame + literalStart, pos - literalStart, out, length, capacity) ||
+                length + 2 > capacity) {
+                return 0;
+            }
+            out[length++] = 0x80 | (run - FRAME_RLE_MIN_RUN);
+            out[length++] = frame[pos];
+            literalStart = pos + run;
+        }
+        pos += run;
+    }
+    if (!appendLiterals(frame + literalStart, pos - literalStart, out, length, capacity)) {
+        return 0;
+    }
+
+    FrameHeader header;
+    header.magic = FRAME_MAGIC;
+    header.version = FRAME_VERSION;
+    header.codec = FRAME_CODEC_RLE;
+    header.pixelFormat = FRAME_PIXEL_4BPP;
+    header.flags = 0;
+    header.width = DISPLAY_WIDTH;
+    header.height = DISPLAY_HEIGHT;
+    header.rawSize = DISPLAY_FRAME_SIZE;
+    header.payloadSize = length - FRAME_HEADER_SIZE;
+    header.crc32 = frameCrc32(0, frame, DISPLAY_FRAME_SIZE);
+    memcpy(out, &header, sizeof(header));
+    return length;
+}
+
+void setup() {
+    initSerial();
+    delay(1000);
+    rtcStateBegin();
+
+    Serial.println("BENCH_BEGIN");
+    Serial.printf("INFO chip=%s rev=%d cpu_mhz=%d flash_kb=%u psram_kb=%u sdk=%s built=\"%s %s\"\n",
+                  ESP.getChipModel(), ESP.getChipRevision(), ESP.getCpuFreqMHz(),
+                  ESP.getFlashChipSize() / 1024, ESP.getPsramSize() / 1024, ESP.getSdkVersion(),
+                  __DATE__, __TIME__);
+    reportMemory("boot");
+
+    configManager.init();
+    frameArena.begin();
+    imageFetcher.setFrameArena(&frameArena);
+    frameDecoder.setOutput(&countingSink);
+    reportMemory("setup");
+
+    uint8_t* frame = frameArena.acquire("bench frame");
+    uint8_t* scratch = frameArena.acquire("bench scratch");
+    if (!frame) {
+        Serial.println("BENCH_SKIP all reason=no_frame_buffer");
+        Serial.println("BENCH_END");
+        return;
+    }
+    drawTestFrame(frame);
+
+    benchSpi(frame);
+    reportMemory("spi");
+
+    // A frame without the container magic is passed through as raw data
+    benchDecode("decode_raw", frame, DISPLAY_FRAME_SIZE);
+    if (scratch) {
+        size_t rleLength = buildRleContainer(frame, scratch, frameArena.getSlotSize());
+        if (rleLength > 0) {
+            benchDecode("decode_rle", scratch, rleLength);
+        }
+    } else {
+        Serial.println("BENCH_SKIP decode_rle reason=single_slot_arena");
+    }
+    reportMemory("decode");
+
+    if (!configManager.isConfigured()) {
+        Serial.println("BENCH_SKIP network reason=unconfigured");
+    } else if (!benchWiFi()) {
+        Serial.println("BENCH_SKIP network reason=wifi_failed");
+    } else {
+        reportMemory("wifi");
+        char url[MAX_URL_LENGTH];
+        imageFetcher.buildImageURL(url, FRAME_FILE_EXTENSION);
+
+        benchTls(url);
+        reportMemory("tls");
+
+        // The published frame, decoded with whatever codec the server chose
+        size_t length = benchHttpsRead(url, frame, frameArena.getSlotSize());
+        if (length > 0) {
+            benchDecode("decode_published", frame, length);
+        }
+
+        benchFetcher();
+        reportMemory("fetch");
+    }
+
+    frameArena.release(frame);
+    frameArena.release(scratch);
+    reportMemory("end");
+    Serial.println("BENCH_END");
+}
+
+void loop() {
+    // One run per reset keeps every result comparable
+    delay(1000);
+}
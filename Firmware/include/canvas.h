@@ -0,0 +1,42 @@
+#ifndef CANVAS_H
+#define CANVAS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "config.h"
+
+// Drawing surface over a packed 4bpp frame buffer (two pixels per byte,
+// left pixel in the high nibble), laid out exactly as the panel expects.
+// All drawing is clipped to the canvas. Colors are EPD_7IN3F_* indices.
+class Canvas {
+public:
+    Canvas(uint8_t* buffer, int width = DISPLAY_WIDTH, int height = DISPLAY_HEIGHT);
+    
+    uint8_t* getBuffer() const { return buffer; }
+    size_t getBufferSize() const { return (size_t)rowBytes * height; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    
+    void fill(uint8_t color);
+    void fillRect(int x, int y, int w, int h, uint8_t color);
+    void setPixel(int x, int y, uint8_t color);
+    
+    // Packed 4bpp sprite, spriteWidth pixels per row (rows padded to a byte)
+    void blit(const uint8_t* sprite, int x, int y, int spriteWidth, int spriteHeight);
+    
+    // Returns the x just past the last glyph
+    int drawText(const char* text, int x, int y, int scale, uint8_t color);
+    int drawTextCentered(const char* text, int y, int scale, uint8_t color);
+    static int textWidth(const char* text, int scale);
+    
+private:
+    uint8_t* buffer;
+    int width;
+    int height;
+    int rowBytes;
+    
+    void fillSpan(uint8_t* row, int x0, int x1, uint8_t color);
+    void drawGlyph(char c, int x, int y, int scale, uint8_t color);
+};
+
+#endif // CANVAS_H
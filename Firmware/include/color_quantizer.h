@@ -0,0 +1,52 @@
+#ifndef COLOR_QUANTIZER_H
+#define COLOR_QUANTIZER_H
+
+#include "frame_sink.h"
+#include "config.h"
+
+enum PixelFormat {
+    PIXEL_RGB888 = 0,   // 3 bytes per pixel: R, G, B
+    PIXEL_RGB565        // 2 bytes per pixel, little-endian
+};
+
+// Turns a streamed true-color image into a packed 4bpp panel frame. Rows
+// are quantized as soon as they are complete: each pixel is mapped to the
+// nearest panel color through the RGB555 table in palette_lut.h and its
+// error is spread Floyd-Steinberg style, which needs only the current and
+// the next row of error terms. Input must already be in panel orientation
+// (DISPLAY_WIDTH x DISPLAY_HEIGHT); the format follows from the frame size.
+class ColorQuantizer : public FrameSink {
+public:
+    ColorQuantizer();
+
+    void setOutput(FrameSink* sink) { output = sink; }
+
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+
+    // One row in, one packed panel row (DISPLAY_ROW_BYTES) out
+    void quantizeRow(const uint8_t* pixels, uint8_t* packed);
+
+private:
+    // Error terms in 1/16 units, one pixel of padding on each side so the
+    // kernel needs no edge checks
+    static const int ERROR_ROW = (DISPLAY_WIDTH + 2) * 3;
+
+    FrameSink* output;
+    PixelFormat format;
+    size_t rowBytes;            // Input bytes per row
+    size_t rowFill;             // Bytes of the current row received so far
+    uint16_t rowsDone;
+    bool frameActive;
+    bool outputFailed;
+    uint8_t inputRow[DISPLAY_WIDTH * 3];
+    uint8_t packedRow[DISPLAY_ROW_BYTES];
+    int16_t errorRows[2][ERROR_ROW];
+    int16_t* currentError;
+    int16_t* nextError;
+
+    bool emitRow(const uint8_t* pixels);
+};
+
+#endif // COLOR_QUANTIZER_H
@@ -10,15 +10,33 @@
 #define EPD_DIN_PIN     35  // GPIO35 - SPI MOSI (Data In)
 #define EPD_SCK_PIN     36  // GPIO36 - SPI Clock
 
+// E-Paper SPI clock - the controller accepts up to 20 MHz (50 ns write cycle);
+// 10 MHz leaves margin for jumper-wire connections
+#define EPD_SPI_CLOCK_HZ 10000000
+
+// BUSY handling - a full refresh takes 20-30 s; light sleep during it drops
+// the USB CDC serial link, so set EPD_BUSY_LIGHT_SLEEP to 0 when debugging
+#define EPD_BUSY_TIMEOUT_MS   60000
+#define EPD_BUSY_LIGHT_SLEEP  1
+
 // Display specifications
 #define DISPLAY_WIDTH   800
 #define DISPLAY_HEIGHT  480
+#define DISPLAY_ROW_BYTES  (DISPLAY_WIDTH / 2)                 // 4bpp, 2 pixels per byte
+#define DISPLAY_FRAME_SIZE (DISPLAY_ROW_BYTES * DISPLAY_HEIGHT)
 
 // Network Configuration
 #define AP_SSID         "SmartDashboard-Setup"
 #define AP_PASSWORD     "configure123"
+#define AP_PORTAL_URL   "http://192.168.4.1/"  // Default soft-AP address
 #define CONFIG_TIMEOUT  300000  // 5 minutes timeout for configuration
 
+// WiFi connection
+#define WIFI_CONNECT_TIMEOUT_MS 30000    // Full scan + DHCP
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 3000  // Cached BSSID/channel + static lease
+#define WIFI_POLL_INTERVAL_MS   10
+#define WIFI_CACHE_MAX_REUSE    72       // Renew the DHCP lease every 72 wakes (~12 h)
+
 // Web server configuration
 #define WEB_SERVER_PORT 80
 #define DNS_PORT        53
@@ -27,13 +45,98 @@
 #define GITHUB_HOST     "raw.githubusercontent.com"
 #define GITHUB_PORT     443
 #define MAX_IMAGE_SIZE  200000  // 200KB max image size
+#define STREAM_CHUNK_SIZE 4096  // Bounce buffer between WiFiClient and SPI when streaming
+#define DOWNLOAD_STALL_TIMEOUT_MS 10000  // No data for this long - resume with a Range request
+#define DOWNLOAD_RESUME_ATTEMPTS  3      // Range retries per transfer
+#define DOWNLOAD_RESUME_DELAY_MS  500    // Grows linearly with each attempt
+#define FRAME_FILE_EXTENSION    ".epf"  // Compressed frame container published by the server
+#define LEGACY_FRAME_EXTENSION  ".bin"  // Raw frame, used when no container exists
+#define TRUECOLOR_FRAME_EXTENSION ".rgb"  // RGB888/RGB565 image from other tools, quantized on the device
+#define TRUECOLOR_MAX_SIZE      (DISPLAY_WIDTH * DISPLAY_HEIGHT * 3)
+#define DELTA_FRAME_EXTENSION   ".delta.epf"  // Patches against the previously published frame
+#define MANIFEST_EXTENSION      ".manifest.json"  // Frame hash and next generation time, fetched first
+#define MANIFEST_VERSION        1
+#define MANIFEST_MAX_SIZE       1024
+#define TILE_INDEX_EXTENSION    ".tiles.idx"  // Tile hashes and pack offsets of the frame
+#define TILE_PACK_EXTENSION     ".tiles.pak"  // Distinct tiles, fetched with Range requests
+#define TILE_RANGE_GAP          2048     // Cached tiles up to this size are downloaded again
+                                         // rather than split a range in two
 
-// Update intervals
-#define UPDATE_INTERVAL_MS      3600000  // 1 hour in milliseconds
-#define WIFI_RETRY_DELAY_MS     30000    // 30 seconds between WiFi retries
+// On-device weather overlay: the server publishes a base map (<name>_base.epf)
+// and <name>.weather.json; the firmware draws date, time and weather itself
+#define WEATHER_OVERLAY_ENABLED 1
+#define WEATHER_EXTENSION       ".weather.json"
+#define BASE_FRAME_VARIANT      "_base"
+
+// Update schedule - deep sleep wakeups are aligned to the server's generation cron
+#define SERVER_UPDATE_PERIOD_S  600      // '*/10 * * * *' in .github/workflows/generate-maps.yml
+#define SERVER_PUBLISH_DELAY_S  180      // Actions start delay + render + push + CDN
+#define MIN_SLEEP_S             60       // Shortest scheduled sleep (fast retries excepted)
+#define MAX_SCHEDULED_SLEEP_S   86400    // Ignore manifest wake times further out than this
+#define SCHEDULE_JITTER_S       120      // Per-device offset that spreads a fleet over each slot
+#define COLD_BOOT_JITTER_MS     8000     // Stagger after power returns to the whole fleet
+#define RETRY_BASE_DELAY_S      60       // First retry after a failed update
+#define MAX_RETRY_DELAY_S       3600     // Backoff ceiling
+#define FAST_RETRY_DELAY_S      20       // Retry after a transient network or 5xx error...
+#define FAST_RETRY_ATTEMPTS     2        // ...this many times before backing off
+#define WIFI_FAILURES_BEFORE_CONFIG 6    // Failed wakeups before falling back to config mode
+#define CLOCK_RESYNC_INTERVAL_S 3600     // SNTP resync period (RTC clock drifts in deep sleep)
+#define NTP_SERVER_1            "pool.ntp.org"
+#define NTP_SERVER_2            "time.google.com"
 #define CONFIG_CHECK_INTERVAL   5000     // Check for configuration every 5 seconds
+#define MIN_VALID_EPOCH         1700000000UL  // Anything before this is an unsynchronised clock
+
+// Adaptive update policy (update_policy.h). A weak link wakes every
+// WEAK_LINK_INTERVAL_SCALE-th slot and holds back OTA; a critical battery
+// spreads wakes by CRITICAL_BATTERY_INTERVAL_SCALE and skips OTA too.
+#define LINK_WEAK_RSSI_DBM      -78      // Smoothed RSSI below this is a weak link...
+#define LINK_GOOD_RSSI_DBM      -72      // ...until it is back above this
+#define LINK_SLOW_KBPS          12       // Smoothed download throughput below this is weak too
+#define LINK_MIN_SAMPLE_BYTES   16384    // Shorter downloads do not rate the link
+#define WEAK_LINK_INTERVAL_SCALE 2
+
+// Battery through a divider on an ADC1 pin (ADC2 is unusable with WiFi on);
+// -1 when the board has none, which leaves the battery out of the policy.
+// Low: clock-only overlay changes wait up to LOW_BATTERY_CLOCK_AGE_S.
+// Critical: they wait longer and update wakes are spread out as well.
+#define BATTERY_ADC_PIN         -1
+#define BATTERY_DIVIDER_RATIO   2        // Battery voltage / pin voltage
+#define BATTERY_LOW_MV          3600
+#define BATTERY_CRITICAL_MV     3450
+#define BATTERY_HYSTERESIS_MV   100      // Recovery needed before a level is left
+#define LOW_BATTERY_CLOCK_AGE_S 3600
+#define CRITICAL_BATTERY_CLOCK_AGE_S 10800
+#define CRITICAL_BATTERY_INTERVAL_SCALE 3
+
+// Playlist: further frames shown in turn between server updates. Each view
+// holds one raw frame slot on LittleFS (192KB) plus one shared spare, so
+// 4 views take 5 of the ~1.3MB partition's slots and leave room for caches
+#define PLAYLIST_MAX_VIEWS      4        // Including the main image path
+#define PLAYLIST_DEFAULT_DWELL_MIN 10    // Minutes each view stays on the panel
+#define PLAYLIST_MAX_DWELL_MIN  1440
+
+// Decoded tiles kept on LittleFS next to the frame slots, evicted least
+// recently used; 96 tiles take 300KB, what the playlist slots leave free
+#define TILE_CACHE_SLOTS        96
+
+// Over-the-air updates, published to the server repository by
+// scripts/publish_firmware.py and installed during a normal update wake
+#define OTA_ENABLED             1
+#define FIRMWARE_VERSION        "1.0.0"
+#define FIRMWARE_BUILD          1        // Bump for every published image; only newer builds install
+#define OTA_MANIFEST_PATH       "firmware/manifest.json"
+#define OTA_MAX_IMAGE_SIZE      0x140000 // app0/app1 in the default 4MB partition table
+#define OTA_CHECK_INTERVAL_S    21600    // Manifest request at most every 6 hours
+#define OTA_TRIAL_BOOTS         3        // Starts that never reach an update cycle: the image crashes
+#define OTA_TRIAL_CYCLES        8        // Update cycles in a row that fail on trial
+
+// Configuration storage: one versioned, CRC-checked blob in NVS
+#define CONFIG_NVS_NAMESPACE    "dashboard"
+#define CONFIG_NVS_KEY          "config"
+#define CONFIG_VERSION          3        // 1 was the byte-wise EEPROM layout below
 
-// EEPROM Configuration addresses
+// Legacy EEPROM layout - only read once, to migrate it into NVS
+#define EEPROM_NVS_NAMESPACE    "eeprom"  // Where the Arduino EEPROM emulation keeps its sector
 #define EEPROM_SIZE             512
 #define EEPROM_WIFI_SSID_ADDR   0
 #define EEPROM_WIFI_PASS_ADDR   64
@@ -47,5 +150,8 @@
 #define MAX_PASSWORD_LENGTH     63
 #define MAX_REPO_LENGTH         63
 #define MAX_PATH_LENGTH         63
+// https://GITHUB_HOST/<repo>/main/<path> plus room for a variant and extension
+#define MAX_URL_LENGTH          (sizeof("https://" GITHUB_HOST "/") + MAX_REPO_LENGTH + \
+                                 sizeof("/main/") + MAX_PATH_LENGTH + 24)
 
 #endif // CONFIG_H
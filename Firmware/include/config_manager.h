@@ -2,11 +2,13 @@
 #define CONFIG_MANAGER_H
 
 #include <Arduino.h>
-#include <EEPROM.h>
+#include <Preferences.h>
 #include <ArduinoJson.h>
 #include "config.h"
 #include "default_config.h"
 
+// Stored as-is in NVS. New fields go at the end and get a migration step
+// in ConfigManager::migrateConfig() along with a CONFIG_VERSION bump.
 struct DashboardConfig {
     char wifiSSID[MAX_SSID_LENGTH + 1];
     char wifiPassword[MAX_PASSWORD_LENGTH + 1];
@@ -14,12 +16,28 @@ struct DashboardConfig {
     char githubImagePath[MAX_PATH_LENGTH + 1];   // e.g., "dashboard_480x800.png"
     bool isConfigured;
     uint16_t magicNumber;
+    
+    // Version 3: views shown after githubImagePath, each for dwellMinutes
+    uint8_t playlistLength;
+    uint16_t dwellMinutes;
+    char playlist[PLAYLIST_MAX_VIEWS - 1][MAX_PATH_LENGTH + 1];
 };
 
 class ConfigManager {
 private:
     DashboardConfig config;
     bool configLoaded;
+    Preferences prefs;
+    
+    // Request URL prefixes, built whenever a configuration is saved or
+    // loaded so the fetcher never assembles them from Strings
+    char repoURL[MAX_URL_LENGTH];
+    char viewURLs[PLAYLIST_MAX_VIEWS][MAX_URL_LENGTH];
+    
+    void buildURLs();
+    bool readStoredConfig();
+    bool migrateConfig(uint16_t fromVersion);
+    bool migrateFromEEPROM();
     
 public:
     ConfigManager();
@@ -36,10 +54,23 @@ public:
     const char* getGitHubImagePath() const { return config.githubImagePath; }
     bool isConfigured() const { return config.isConfigured && configLoaded; }
     
+    // Playlist views; view 0 is the GitHub image path
+    uint8_t getViewCount() const { return 1 + config.playlistLength; }
+    const char* getViewPath(uint8_t view) const;
+    uint32_t getDwellSeconds() const;
+    
+    // "https://<host>/<repo>/main/", and that plus a view path without its
+    // extension; empty until a valid configuration is saved or loaded
+    const char* getRepoURL() const { return repoURL; }
+    const char* getViewURL(uint8_t view) const;
+    
     // Setters
     bool setWiFiCredentials(const char* ssid, const char* password);
     bool setGitHubInfo(const char* repo, const char* imagePath);
     void setConfigured(bool configured);
+    void clearPlaylist();
+    bool addPlaylistPath(const char* path);
+    bool setDwellMinutes(uint16_t minutes);
     
     // Validation
     bool validateConfig() const;
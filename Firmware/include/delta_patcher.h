@@ -0,0 +1,60 @@
+#ifndef DELTA_PATCHER_H
+#define DELTA_PATCHER_H
+
+#include "frame_sink.h"
+#include "frame_format.h"
+#include "frame_store.h"
+
+#define DELTA_BASE_BUFFER_SIZE 1024  // Unchanged base bytes copied per flash read
+
+// Applies a decoded delta payload to the frame held in the FrameStore and
+// streams the patched frame to the output. Only the dirty rectangles are
+// downloaded; everything between them is copied from flash. The panel has
+// no windowed RAM writes, so the output is still a complete frame.
+class DeltaPatcher : public FrameSink {
+public:
+    DeltaPatcher();
+    
+    void setBase(FrameStore* store) { base = store; }
+    void setOutput(FrameSink* sink) { output = sink; }
+    
+    bool beginFrame(size_t deltaSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+    
+    // True when the delta carried no changes and nothing was sent to the panel
+    bool wasUnchanged() const { return unchanged; }
+    
+private:
+    enum Stage {
+        STAGE_HEADER,  // Collecting FrameDeltaHeader
+        STAGE_RECT,    // Collecting the next FrameDeltaRect
+        STAGE_DATA,    // Forwarding rectangle rows
+        STAGE_DONE,
+        STAGE_ERROR
+    };
+    
+    FrameSink* output;
+    FrameStore* base;
+    Stage stage;
+    FrameDeltaHeader header;
+    FrameDeltaRect rect;
+    size_t fieldBytes;
+    uint16_t rectsLeft;
+    uint16_t rowsLeft;
+    size_t rowBytesLeft;
+    size_t framePos;
+    uint32_t crc;
+    bool outputStarted;
+    bool unchanged;
+    
+    uint8_t baseBuffer[DELTA_BASE_BUFFER_SIZE];
+    
+    bool collect(void* field, size_t fieldSize, const uint8_t*& data, size_t& length);
+    bool startPatching();
+    bool startRect();
+    bool copyBase(size_t until);
+    bool emit(const uint8_t* data, size_t length);
+};
+
+#endif // DELTA_PATCHER_H
@@ -3,33 +3,59 @@
 
 #include "epd7in3f.h"
 #include "qr_code.h"
+#include "canvas.h"
+#include "frame_arena.h"
+#include "frame_sink.h"
+#include "frame_decoder.h"
 #include "config.h"
 
-class DisplayHandler {
+// WiFi QR code of the setup screens, between their title and instructions
+#define CONFIG_QR_CENTER_Y   (DISPLAY_HEIGHT / 2 - 20)
+#define CONFIG_QR_MAX_PIXELS 300
+#define CONFIG_QR_MAX_SCALE  8
+
+class DisplayHandler : public FrameSink {
 public:
     DisplayHandler();
     ~DisplayHandler();
     
     bool initialize();
+    void setFrameArena(FrameArena* arena) { frameArena = arena; }
     void displayImage(const uint8_t* imageData, size_t dataSize);
     void showStatus(const char* message);
     void showSimpleMessage(const char* message);
     void showColorTest();
-    void showConfigurationQR();
+    void showConfigurationQR(bool wifiFailed = false);
     void clear();
-    void sleep();
+    void sleep();  // No-op unless the panel was woken for drawing
+    void setLowPowerWait(bool enable);  // Call once the radio is off
+    
+    // False after a status screen, a QR code or a cold boot
+    bool showsFrame() const;
+    
+    // Streaming frame upload straight into the panel RAM
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
     
 private:
     EPD7in3f epd;
+    FrameArena* frameArena;
     bool initialized;
+    bool frameActive;
+    size_t frameBytesWritten;
+    uint32_t spiMicros;  // SPI time of the current frame, for metrics
+    
+    // Status screens baked into flash (include/screen_assets.h) stream
+    // through these straight into the panel RAM
+    FrameDecoder screenDecoder;
+    QROverlay qrOverlay;
     
-    // Convert RGB image data to e-paper format
-    void convertImageData(const uint8_t* rgbData, size_t dataSize, uint8_t* epdData);
-    uint8_t getClosestColor(uint8_t r, uint8_t g, uint8_t b);
+    bool wakePanel();  // Lazy EPD reset and init before the first draw
+    bool showScreen(const uint8_t* screen, size_t screenSize, bool withQR);
     
-    // QR code display functions
-    void displayQRWithInstructions();
-    void drawText(uint8_t* buffer, const char* text, int x, int y, int scale);
+    uint8_t* acquireBuffer(const char* owner);
+    void releaseBuffer(uint8_t* buffer);
 };
 
 #endif // DISPLAY_HANDLER_H
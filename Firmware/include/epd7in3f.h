@@ -41,20 +41,40 @@ public:
     EPD7in3f();
     ~EPD7in3f();
     
+    // init() wakes the controller and sleep() puts it into deep sleep; both
+    // do nothing if the panel is already in that state
     int init(void);
     void reset(void);
     void sleep(void);
+    bool isAwake(void) const { return awake; }
+    void setSpiClock(uint32_t hz);  // Takes effect immediately if the bus is up
     void clear(UBYTE color);
     void display(const UBYTE *image);
     void displayPart(const UBYTE *image, UWORD xstart, UWORD ystart, 
                      UWORD image_width, UWORD image_height);
     void showColorBlocks(void);
+    
+    // Streaming upload: start the frame, push it in any number of blocks,
+    // then call turnOnDisplay() once the last byte has been sent
+    void startFrameTransfer(void);
+    void sendDataBlock(const UBYTE *data, UDOUBLE length);
     void turnOnDisplay(void);
-    void busyHigh(void);
+    
+    // Non-blocking refresh: startRefresh() returns while the panel updates
+    // (20-30 s); the next command, or finishRefresh(), waits for it
+    void startRefresh(void);
+    bool finishRefresh(void);
+    bool isRefreshing(void) const { return refreshing; }
+    
+    // Waits on the BUSY interrupt; returns false on timeout
+    bool busyHigh(unsigned long timeoutMs = EPD_BUSY_TIMEOUT_MS);
+    // Light sleep while waiting - only valid while the radio is off
+    void setLowPowerWait(bool enable) { lowPowerWait = enable; }
     
     // Low level functions
     void sendCommand(unsigned char command);
     void sendData(unsigned char data);
+    void sendDataRepeat(unsigned char data, UDOUBLE count);
     void digitalWrite(int pin, int value);
     int digitalRead(int pin);
     void delayMs(unsigned int delaytime);
@@ -69,8 +89,15 @@ private:
     unsigned int sck_pin;
     unsigned long width;
     unsigned long height;
+    bool refreshing;
+    bool lowPowerWait;
+    bool busReady;  // GPIO and SPI set up - only needed once per boot
+    uint32_t spiClock;
+    bool awake;     // Controller initialized and out of deep sleep
     
     int ifInit(void);
+    bool blockUntilIdle(unsigned long timeoutMs);
+    bool sleepUntilIdle(unsigned long timeoutMs);
 };
 
 #endif /* __EPD_7IN3F_H__ */
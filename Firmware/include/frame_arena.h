@@ -0,0 +1,37 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "config.h"
+
+#define FRAME_ARENA_SLOTS 2  // Second slot only when PSRAM is available
+
+// Frame-sized buffers reserved once in setup() and lent out afterwards, so
+// no 192 KB allocation happens at runtime and the heap cannot fragment
+// around them. PSRAM is preferred; without it a single slot is taken from
+// internal RAM. Each slot has one owner at a time.
+class FrameArena {
+public:
+    FrameArena();
+    ~FrameArena();
+    
+    bool begin();
+    
+    // Returns nullptr when every slot is in use; owner is for diagnostics
+    uint8_t* acquire(const char* owner);
+    void release(uint8_t* buffer);
+    
+    size_t getSlotSize() const { return DISPLAY_FRAME_SIZE; }
+    int getSlotCount() const { return slotCount; }
+    int getFreeSlots() const;
+    bool isInPsram() const { return inPsram; }
+    
+private:
+    uint8_t* memory;
+    int slotCount;
+    bool inPsram;
+    const char* owners[FRAME_ARENA_SLOTS];
+};
+
+#endif // FRAME_ARENA_H
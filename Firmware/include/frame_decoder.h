@@ -0,0 +1,84 @@
+#ifndef FRAME_DECODER_H
+#define FRAME_DECODER_H
+
+#include "frame_sink.h"
+#include "frame_format.h"
+
+#define FRAME_DECODE_BUFFER_SIZE 1024  // Staging buffer between decoder and output sink
+
+struct InflateState;
+
+// Streaming decoder for the compressed frame container. It sits between the
+// downloader and the panel: container bytes go in, raw 4bpp rows come out as
+// soon as they are decoded. Streams without the container magic are passed
+// through unchanged so legacy raw .bin files keep working, or to the
+// true-color sink when their size is that of an RGB888/RGB565 image. Delta
+// containers decode to a patch list, which goes to the delta sink instead.
+class FrameDecoder : public FrameSink {
+public:
+    FrameDecoder();
+    ~FrameDecoder();
+    
+    void setOutput(FrameSink* sink) { frameOutput = sink; }
+    void setDeltaOutput(FrameSink* sink) { deltaOutput = sink; }
+    void setTrueColorOutput(FrameSink* sink) { trueColorOutput = sink; }
+    // Containers of any other size are rejected; tiles use TILE_SIZE
+    void setGeometry(uint16_t width, uint16_t height) { frameWidth = width; frameHeight = height; }
+    
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+    
+    bool isContainer() const { return mode != MODE_PASSTHROUGH && mode != MODE_HEADER; }
+    uint8_t getCodec() const { return header.codec; }
+    bool isDelta() const { return isContainer() && (header.flags & FRAME_FLAG_DELTA); }
+    
+private:
+    enum Mode {
+        MODE_HEADER,       // Collecting the first FRAME_HEADER_SIZE bytes
+        MODE_PASSTHROUGH,  // Legacy raw frame
+        MODE_RAW,
+        MODE_RLE,
+        MODE_ZLIB,
+        MODE_ERROR
+    };
+    
+    FrameSink* frameOutput;
+    FrameSink* deltaOutput;
+    FrameSink* trueColorOutput;
+    FrameSink* output;  // Whichever of them the current frame decodes to
+    uint16_t frameWidth;
+    uint16_t frameHeight;
+    Mode mode;
+    FrameHeader header;
+    size_t streamSize;
+    size_t headerBytes;
+    size_t payloadRead;
+    size_t decodedBytes;
+    uint32_t crc;
+    bool outputStarted;
+    bool zlibDone;
+    
+    // RLE state carried across chunk boundaries
+    uint8_t rleControl;
+    size_t rleRemaining;
+    bool rleExpectValue;
+    
+    InflateState* inflate;
+    size_t windowPos;
+    
+    uint8_t outBuffer[FRAME_DECODE_BUFFER_SIZE];
+    size_t outLength;
+    
+    bool parseHeader();
+    bool startPassthrough();
+    bool decodePayload(const uint8_t* data, size_t length);
+    bool decodeRle(const uint8_t* data, size_t length);
+    bool decodeZlib(const uint8_t* data, size_t length);
+    bool emit(const uint8_t* data, size_t length);
+    bool emitRepeat(uint8_t value, size_t count);
+    bool flushOutput();
+    void releaseInflate();
+};
+
+#endif // FRAME_DECODER_H
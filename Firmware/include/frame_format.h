@@ -0,0 +1,98 @@
+#ifndef FRAME_FORMAT_H
+#define FRAME_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Compressed frame container written by Server/utils/frame_codec.py.
+// All fields are little-endian; the payload follows the 24-byte header.
+#define FRAME_MAGIC             0x46445045  // "EPDF"
+#define FRAME_VERSION           1
+#define FRAME_HEADER_SIZE       24
+
+#define FRAME_CODEC_RAW         0
+#define FRAME_CODEC_RLE         1  // c < 0x80: c+1 literals, else repeat next byte (c & 0x7F) + 3
+#define FRAME_CODEC_ZLIB        2  // zlib stream limited to a FRAME_INFLATE_WINDOW window
+
+#define FRAME_PIXEL_4BPP        0
+
+#define FRAME_FLAG_DELTA        0x01  // Payload is a patch list against the previous frame
+
+#define FRAME_RLE_MIN_RUN       3
+#define FRAME_INFLATE_WINDOW    4096  // Must match ZLIB_WINDOW_BITS on the server
+
+struct __attribute__((packed)) FrameHeader {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t codec;
+    uint8_t pixelFormat;
+    uint8_t flags;
+    uint16_t width;
+    uint16_t height;
+    uint32_t rawSize;
+    uint32_t payloadSize;
+    uint32_t crc32;
+};
+
+static_assert(sizeof(FrameHeader) == FRAME_HEADER_SIZE, "FrameHeader layout mismatch");
+
+// Decoded payload of a FRAME_FLAG_DELTA container: this header, then
+// rectCount rectangles, each followed by its rows of packed pixels.
+// Rectangles are sorted by y and never share a row, so the patched frame
+// can be produced top to bottom in a single pass over the base frame.
+#define FRAME_DELTA_MAGIC       0x44445045  // "EPDD"
+#define FRAME_DELTA_HEADER_SIZE 16
+#define FRAME_DELTA_RECT_SIZE   8
+
+struct __attribute__((packed)) FrameDeltaHeader {
+    uint32_t magic;
+    uint32_t baseCrc;    // CRC-32 of the frame the patches apply to
+    uint32_t targetCrc;  // CRC-32 of the patched frame
+    uint16_t rectCount;
+    uint16_t reserved;
+};
+
+struct __attribute__((packed)) FrameDeltaRect {
+    uint16_t x;       // Pixels, even
+    uint16_t y;
+    uint16_t width;   // Pixels, even
+    uint16_t height;
+};
+
+static_assert(sizeof(FrameDeltaHeader) == FRAME_DELTA_HEADER_SIZE, "FrameDeltaHeader layout mismatch");
+static_assert(sizeof(FrameDeltaRect) == FRAME_DELTA_RECT_SIZE, "FrameDeltaRect layout mismatch");
+
+// Tiled frame (<name>.tiles.idx): this header, then one entry per tile in
+// row-major order. Each entry points into <name>.tiles.pak, which holds
+// every distinct tile once as a TILE_SIZE x TILE_SIZE frame container, so
+// a tile is identified by the CRC-32 of its pixels wherever it appears.
+#define TILE_INDEX_MAGIC        0x49545045  // "EPTI"
+#define TILE_INDEX_VERSION      1
+#define TILE_INDEX_HEADER_SIZE  12
+#define TILE_INDEX_ENTRY_SIZE   12
+#define TILE_SIZE               80
+#define TILE_ROW_BYTES          (TILE_SIZE / 2)
+#define TILE_BYTES              (TILE_ROW_BYTES * TILE_SIZE)
+
+struct __attribute__((packed)) TileIndexHeader {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t tileSize;
+    uint8_t columns;
+    uint8_t rows;
+    uint32_t frameCrc;   // CRC-32 of the assembled frame
+};
+
+struct __attribute__((packed)) TileIndexEntry {
+    uint32_t crc;        // CRC-32 of the decoded tile
+    uint32_t offset;     // Of its container in the pack
+    uint32_t length;
+};
+
+static_assert(sizeof(TileIndexHeader) == TILE_INDEX_HEADER_SIZE, "TileIndexHeader layout mismatch");
+static_assert(sizeof(TileIndexEntry) == TILE_INDEX_ENTRY_SIZE, "TileIndexEntry layout mismatch");
+
+// Standard CRC-32 (same as zlib.crc32); start with crc = 0
+uint32_t frameCrc32(uint32_t crc, const uint8_t* data, size_t length);
+
+#endif // FRAME_FORMAT_H
@@ -0,0 +1,68 @@
+#ifndef FRAME_PIPELINE_H
+#define FRAME_PIPELINE_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "frame_sink.h"
+#include "config.h"
+
+#define PIPELINE_CHUNK_ROWS 4          // Panel rows per queued chunk
+#define PIPELINE_CHUNK_SIZE (DISPLAY_ROW_BYTES * PIPELINE_CHUNK_ROWS)
+#define PIPELINE_CHUNK_COUNT 8         // Bounded queue depth (~12.8 KB)
+#define PIPELINE_STALL_TIMEOUT_MS 10000
+#define PIPELINE_TASK_STACK 4096
+#define PIPELINE_TASK_PRIORITY 2       // Above loopTask so SPI keeps up with TLS
+
+// Hands frame data from the network task to a display task through a
+// bounded queue of row chunks. The producer returns as soon as a chunk is
+// queued, so TLS reads and SPI upload overlap instead of alternating.
+// beginFrame() and endFrame() run on the caller's task once the queue has
+// drained, so the output sees the usual FrameSink call order. A frame
+// whose queue does not drain in time is only closed on the output once
+// the display task has caught up; call quiesce() before using the output
+// directly.
+class FramePipeline : public FrameSink {
+public:
+    FramePipeline();
+    ~FramePipeline();
+    
+    // Starts the display task; without it data is forwarded synchronously
+    bool begin();
+    void setOutput(FrameSink* sink) { output = sink; }
+    
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+    
+    // Waits out a stalled frame and closes it; false while the display
+    // task is still writing, so the output must be left alone
+    bool quiesce();
+    
+private:
+    struct Chunk {
+        uint8_t data[PIPELINE_CHUNK_SIZE];
+        size_t length;
+    };
+    
+    FrameSink* output;
+    Chunk chunks[PIPELINE_CHUNK_COUNT];
+    QueueHandle_t freeQueue;    // Chunk indices ready to be filled
+    QueueHandle_t filledQueue;  // Chunk indices waiting for the display task
+    SemaphoreHandle_t drained;  // Given when the display task reaches a flush marker
+    TaskHandle_t task;
+    Chunk* current;             // Chunk being filled by the producer
+    uint8_t currentIndex;
+    volatile bool failed;       // Set by the display task when the output rejects data
+    bool markerQueued;          // A flush marker the display task has not reached yet
+    bool stalled;               // A drain timed out; the output frame is still open
+    
+    bool pushCurrent();
+    bool drain();
+    bool waitIdle();
+    static void taskEntry(void* arg);
+    void consume();
+};
+
+#endif // FRAME_PIPELINE_H
@@ -0,0 +1,28 @@
+#ifndef FRAME_SINK_H
+#define FRAME_SINK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Consumer of a packed 4bpp e-paper frame delivered in arbitrary-sized chunks.
+// Producers call beginFrame() once, writeFrame() as data arrives and endFrame()
+// exactly once; commit is false when the stream was cut short.
+class FrameSink {
+public:
+    virtual ~FrameSink() {}
+    
+    virtual bool beginFrame(size_t frameSize) = 0;
+    virtual bool writeFrame(const uint8_t* data, size_t length) = 0;
+    virtual bool endFrame(bool commit) = 0;
+};
+
+// Accepts and drops every frame. Placed behind a FrameStore it caches a
+// frame to flash without drawing it.
+class DiscardSink : public FrameSink {
+public:
+    bool beginFrame(size_t) override { return true; }
+    bool writeFrame(const uint8_t*, size_t) override { return true; }
+    bool endFrame(bool commit) override { return commit; }
+};
+
+#endif // FRAME_SINK_H
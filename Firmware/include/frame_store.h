@@ -0,0 +1,94 @@
+#ifndef FRAME_STORE_H
+#define FRAME_STORE_H
+
+#include <FS.h>
+#include "frame_sink.h"
+#include "frame_format.h"
+#include "config.h"
+
+// One slot per playlist view plus a spare to record into, so every view
+// keeps a valid frame while its replacement downloads
+#define FRAME_STORE_MAX_VIEWS  PLAYLIST_MAX_VIEWS
+#define FRAME_STORE_SLOT_COUNT (FRAME_STORE_MAX_VIEWS + 1)
+#define FRAME_STORE_INDEX_PATH "/frame.idx"
+#define FRAME_STORE_INDEX_MAGIC 0x32444946  // "FID2"
+#define FRAME_STORE_LEGACY_INDEX_MAGIC 0x58444946  // "FIDX", single view in two slots
+#define FRAME_STORE_READ_CHUNK 1024
+
+// Keeps the last frame that reached the panel on LittleFS, so a failed
+// download never leaves the device without an image and delta frames have
+// a base to patch. It sits in front of the display as a pass-through sink:
+// every full frame is recorded into a slot no view is using while it
+// streams, and the slot only becomes active once the panel accepted all of
+// it and the slot header carries its CRC. Playlists keep one frame per
+// view; selectView() chooses the view all other calls act on.
+class FrameStore : public FrameSink {
+public:
+    FrameStore();
+    
+    // verify re-reads the active slots and checks their CRCs (cold boot)
+    bool begin(bool verify);
+    void setOutput(FrameSink* sink) { output = sink; }
+    
+    // Fails while a frame is being recorded
+    bool selectView(int view);
+    int getView() const { return view; }
+    
+    bool hasFrame() const { return viewSlot[view] >= 0; }
+    uint32_t getFrameCrc() const { return viewCrc[view]; }
+    
+    // Sequential reads are cheap; the file stays open until closeReader()
+    bool readFrame(size_t offset, uint8_t* buffer, size_t length);
+    void closeReader();
+    
+    // Redraw the cached frame; the sink only commits if the CRC matches
+    bool replay(FrameSink* sink);
+    
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+    
+private:
+    struct LegacyIndex {
+        uint32_t magic;
+        uint32_t sequence;
+        uint32_t slot;
+        uint32_t crc;
+    };
+    
+    struct StoreIndex {
+        uint32_t magic;
+        uint32_t sequence;  // Increments on every committed frame
+        int8_t slot[FRAME_STORE_MAX_VIEWS];      // Active slot per view, -1 for none
+        int8_t previous[FRAME_STORE_MAX_VIEWS];  // Frame before it, -1 once reused
+        uint32_t crc[FRAME_STORE_MAX_VIEWS];
+    };
+    
+    FrameSink* output;
+    bool mounted;
+    int view;
+    int8_t viewSlot[FRAME_STORE_MAX_VIEWS];
+    int8_t previousSlot[FRAME_STORE_MAX_VIEWS];
+    uint32_t viewCrc[FRAME_STORE_MAX_VIEWS];
+    uint32_t sequence;
+    
+    File reader;
+    size_t readerOffset;
+    
+    File writer;
+    bool recording;
+    int recordSlot;
+    size_t recordSize;
+    size_t recordedBytes;
+    uint32_t recordCrc;
+    
+    static const char* slotPath(int slot);
+    bool readIndex(StoreIndex& index);
+    bool readSlotHeader(int slot, FrameHeader& header);
+    bool verifySlot(int slot, uint32_t crc);
+    bool writeIndex();
+    int pickRecordSlot() const;
+    void stopRecording();
+};
+
+#endif // FRAME_STORE_H
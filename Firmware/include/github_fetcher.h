@@ -4,19 +4,82 @@
 #include <WiFi.h>
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
+#include <Preferences.h>
 #include "config_manager.h"
+#include "frame_sink.h"
+#include "frame_decoder.h"
+#include "frame_store.h"
+#include "delta_patcher.h"
+#include "color_quantizer.h"
+#include "frame_arena.h"
+#include "tile_cache.h"
+#include "tile_assembler.h"
+#include "weather_overlay.h"
+#include <ArduinoJson.h>
+#include "config.h"
+
+enum FetchResult {
+    FETCH_FAILED = 0,
+    FETCH_UPDATED,       // New frame received and displayed
+    FETCH_NOT_MODIFIED   // Server ETag matched - nothing downloaded or drawn
+};
+
+// Summary of the published frame, fetched before the frame itself
+struct FrameManifest {
+    uint32_t frameCrc;       // CRC-32 of the decoded frame
+    uint32_t frameSize;      // Bytes of the .epf container
+    uint32_t generated;      // Epoch of the generation that produced it
+    uint32_t nextUpdate;     // Epoch of the next scheduled generation
+    bool hasDelta;
+    uint32_t deltaBaseCrc;   // Frame the .delta.epf applies to
+    bool hasTiles;           // .tiles.idx and .tiles.pak published alongside
+};
 
 class GitHubImageFetcher {
 private:
     ConfigManager* configManager;
     WiFiClientSecure client;
     HTTPClient http;
+    FrameArena* frameArena;
     uint8_t* imageBuffer;
     size_t bufferSize;
     bool bufferAllocated;
+    uint8_t streamChunk[STREAM_CHUNK_SIZE];
+    FrameDecoder frameDecoder;
+    DeltaPatcher deltaPatcher;
+    ColorQuantizer colorQuantizer;
+    FrameStore* frameStore;
+    TileCache* tileCache;
+    TileAssembler tileAssembler;
+    uint8_t view;  // Playlist view whose path the URLs are built from
+    int lastHttpCode;
+    uint32_t lastRetryAfter;  // Seconds from the last response's Retry-After
+    size_t downloadLimit;     // Largest body beginDownload() accepts
+    
+    // Validator of the last frame that reached the panel, persisted in NVS
+    // and cached in RTC memory across deep sleep
+    Preferences prefs;
+    String lastETag;
+    uint32_t lastETagUrlHash;
+    bool etagLoaded;
     
-    String buildImageURL();
-    bool downloadImage(const String& url, uint8_t*& buffer, size_t& size);
+    int beginDownload(const char* url, size_t& size, bool conditional, 
+                      size_t resumeFrom = 0, const String& ifRange = "", size_t rangeEnd = 0);
+    size_t readBody(const char* url, const String& etag, uint8_t* buffer, FrameSink* sink, 
+                    size_t size, bool& sinkFailed);
+    bool resumeDownload(const char* url, const String& etag, size_t offset, size_t size);
+    bool downloadImage(const char* url, uint8_t*& buffer, size_t& size);
+    FetchResult streamImage(const char* url, FrameSink* sink);
+    bool fetchRange(const char* url, uint32_t start, uint32_t end, FrameSink* sink);
+    FetchResult streamTiles(const char* variant, FrameSink* sink);
+    bool assembleTiles(const char* variant, uint8_t* frame);
+    bool fetchJson(const char* url, JsonDocument& doc);
+    bool fetchManifest(FrameManifest& manifest, const char* variant);
+    void loadETag();
+    void saveETag(const char* url, const String& etag);
+    void cacheETagInRtc();
+    static uint32_t hashURL(const char* url);
+    void abortTransfer();
     void freeBuffer();
     
 public:
@@ -24,11 +87,29 @@ public:
     ~GitHubImageFetcher();
     
     bool fetchLatestImage();
+    // Into url (MAX_URL_LENGTH bytes) from the prefix built at config save
+    bool buildImageURL(char* url, const char* extension = LEGACY_FRAME_EXTENSION, const char* variant = "");
+    // No frame-sized buffer needed; variant selects e.g. the base map
+    FetchResult streamLatestImage(FrameSink* sink, const char* variant = "");
+    bool fetchWeather(WeatherData& weather);
+    // Any file of the configured repository, by path from its root
+    bool buildRepoURL(char* url, const char* path);
+    bool fetchRepoJson(const char* path, JsonDocument& doc);
+    // Raw bytes to the sink, resumed like frames; no ETag involved
+    bool streamRepoFile(const char* path, FrameSink* sink, size_t maxSize);
+    void setFrameStore(FrameStore* store);  // Enables delta frames against the cached frame
+    void setFrameArena(FrameArena* arena) { frameArena = arena; }  // Buffer for fetchLatestImage
+    void setTileCache(TileCache* cache);  // Enables tiled frames, assembled in an arena slot
+    void selectView(uint8_t index) { view = index; }  // Playlist entry to fetch, 0 is the image path
+    void clearETag();  // Force the next fetch to download and redraw
+    void endSession();  // Close the kept-alive TLS connection
+    int getLastHttpCode() const { return lastHttpCode; }
+    uint32_t getRetryAfter() const { return lastRetryAfter; }
     uint8_t* getImageBuffer() const { return imageBuffer; }
     size_t getImageSize() const { return bufferSize; }
     bool hasImage() const { return bufferAllocated && imageBuffer != nullptr; }
     
-    // Testing and debugging
+    // Testing and debugging - separate handshake, keep it off the update path
     bool testConnection();
     String getLastError() const;
 };
@@ -0,0 +1,57 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Log lines are formatted into a RAM ring buffer and reach the UART only
+// when logFlush() runs - from idle waits and before sleep - so the
+// download loop never blocks on a full TX FIFO. Writers never wait either:
+// a line that does not fit is dropped and counted. Lines below
+// LOGGER_LEVEL compile out completely; -DLOGGER_LEVEL=0 removes them all.
+// Output still written with Serial directly can appear ahead of lines
+// waiting in the buffer.
+#define LOGGER_LEVEL_NONE   0
+#define LOGGER_LEVEL_ERROR  1
+#define LOGGER_LEVEL_WARN   2
+#define LOGGER_LEVEL_INFO   3
+#define LOGGER_LEVEL_DEBUG  4
+
+#ifndef LOGGER_LEVEL
+#define LOGGER_LEVEL LOGGER_LEVEL_INFO
+#endif
+
+#define LOGGER_BUFFER_SIZE  4096  // Power of two
+#define LOGGER_LINE_MAX     160   // Longer lines are cut short
+
+void logWrite(const char* format, ...) __attribute__((format(printf, 1, 2)));
+// Non-blocking by default: only what the UART takes without waiting.
+// drain writes everything out and waits for the FIFO (before sleep).
+void logFlush(bool drain = false);
+uint32_t logDropped();
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_ERROR
+#define LOGE(...) logWrite(__VA_ARGS__)
+#else
+#define LOGE(...) do {} while (0)
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_WARN
+#define LOGW(...) logWrite(__VA_ARGS__)
+#else
+#define LOGW(...) do {} while (0)
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_INFO
+#define LOGI(...) logWrite(__VA_ARGS__)
+#else
+#define LOGI(...) do {} while (0)
+#endif
+
+#if LOGGER_LEVEL >= LOGGER_LEVEL_DEBUG
+#define LOGD(...) logWrite(__VA_ARGS__)
+#else
+#define LOGD(...) do {} while (0)
+#endif
+
+#endif // LOGGER_H
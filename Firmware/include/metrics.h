@@ -0,0 +1,69 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+
+// Hot-path timing. Each phase keeps last/min/avg/max in RTC memory so the
+// history survives deep sleep. Build with -DMETRICS_ENABLED=0 to compile
+// every METRIC_* macro out completely.
+#ifndef METRICS_ENABLED
+#define METRICS_ENABLED 1
+#endif
+
+enum MetricPhase {
+    METRIC_WIFI_CONNECT = 0,
+    METRIC_TLS_CONNECT,
+    METRIC_TIME_TO_FIRST_BYTE,
+    METRIC_DOWNLOAD,
+    METRIC_SPI_UPLOAD,
+    METRIC_BUSY_POWER_ON,
+    METRIC_BUSY_REFRESH,
+    METRIC_BUSY_POWER_OFF,
+    METRIC_AWAKE,
+    METRIC_PHASE_COUNT
+};
+
+#define METRICS_AVERAGE_SHIFT 3  // Rolling average weight 1/8
+
+#if METRICS_ENABLED
+
+#include <esp_timer.h>
+#include <ArduinoJson.h>
+
+struct MetricStats {
+    uint32_t lastUs;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint32_t avgUs;
+    uint32_t count;
+};
+
+void metricsBegin(bool restored);
+void metricsStart(MetricPhase phase);
+void metricsStop(MetricPhase phase);
+void metricsRecord(MetricPhase phase, uint32_t micros);
+void metricsSetDownloadBytes(uint32_t bytes);
+uint32_t metricsGetDownloadBytes();
+const MetricStats& metricsGet(MetricPhase phase);
+void metricsPrint();
+void metricsToJson(JsonObject obj);
+
+#define METRIC_NOW()                 ((uint32_t)esp_timer_get_time())
+#define METRIC_START(phase)          metricsStart(phase)
+#define METRIC_STOP(phase)           metricsStop(phase)
+#define METRIC_RECORD(phase, micros) metricsRecord(phase, micros)
+#define METRIC_DOWNLOAD_BYTES(bytes) metricsSetDownloadBytes(bytes)
+#define METRICS_PRINT()              metricsPrint()
+
+#else
+
+#define METRIC_NOW()                 0
+#define METRIC_START(phase)          do {} while (0)
+#define METRIC_STOP(phase)           do {} while (0)
+#define METRIC_RECORD(phase, micros) do {} while (0)
+#define METRIC_DOWNLOAD_BYTES(bytes) do {} while (0)
+#define METRICS_PRINT()              do {} while (0)
+
+#endif // METRICS_ENABLED
+
+#endif // METRICS_H
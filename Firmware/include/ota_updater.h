@@ -0,0 +1,80 @@
+#ifndef OTA_UPDATER_H
+#define OTA_UPDATER_H
+
+#include <Preferences.h>
+#include "frame_sink.h"
+#include "frame_arena.h"
+#include "config.h"
+
+class GitHubImageFetcher;
+struct OtaInflateState;
+
+#define OTA_NVS_NAMESPACE   "ota"
+#define OTA_SHA256_LENGTH   32
+#define OTA_INFLATE_WINDOW  32768  // Full zlib window; the publisher compresses with wbits=15
+
+// Firmware published next to the frames by scripts/publish_firmware.py
+struct FirmwareManifest {
+    uint32_t build;           // Monotonic build number, compared with FIRMWARE_BUILD
+    uint32_t size;            // Bytes of the zlib-compressed file
+    uint32_t imageSize;       // Bytes of the application image
+    uint8_t sha256[OTA_SHA256_LENGTH];  // Of the application image
+    char file[MAX_PATH_LENGTH + 1];     // Repository path of the compressed image
+};
+
+// Installs firmware from the server repository over the fetcher's open
+// connection. The compressed image is inflated by the ROM inflater as it
+// streams in and goes straight to Update.write(), so no image-sized buffer
+// is ever held; the SHA-256 of the written image is checked before the
+// new partition is made bootable. A new image boots on trial: it is kept
+// once it completes an update cycle. One that keeps restarting before it
+// gets that far is rolled back and never installed again; one whose cycles
+// keep failing (the network may be down just as well) is rolled back but
+// may be offered again at the next check.
+class OtaUpdater : public FrameSink {
+public:
+    OtaUpdater();
+    ~OtaUpdater();
+    
+    // The inflater borrows an arena slot instead of heap
+    void setFrameArena(FrameArena* arena) { frameArena = arena; }
+    
+    // Reads the trial state; cold boots count against a trial image
+    void begin(bool coldBoot);
+    bool onTrial() const { return trial; }
+    // Keeps a trial image after a good cycle. A failed one is counted and
+    // the image rolled back after OTA_TRIAL_CYCLES (does not return then).
+    void confirm(bool healthy);
+    
+    bool checkDue() const;
+    // True once a newer image is installed; the caller restarts into it
+    bool install(GitHubImageFetcher& fetcher);
+    
+    // Compressed image in, application image out to the OTA partition
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+
+private:
+    FrameArena* frameArena;
+    Preferences prefs;
+    bool trial;
+    
+    FirmwareManifest manifest;
+    OtaInflateState* inflate;
+    uint8_t* inflateBuffer;
+    size_t windowPos;
+    size_t compressedRead;
+    size_t imageWritten;
+    bool inflateDone;
+    bool failed;
+    
+    bool fetchManifest(GitHubImageFetcher& fetcher);
+    bool inflateChunk(const uint8_t* data, size_t length);
+    bool writeImage(const uint8_t* data, size_t length);
+    void releaseInflate();
+    void clearTrial();  // Within an open prefs session
+    void rollBack(const char* reason, bool blacklist);
+};
+
+#endif // OTA_UPDATER_H
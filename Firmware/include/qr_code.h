@@ -2,31 +2,56 @@
 #define QR_CODE_H
 
 #include <Arduino.h>
+#include "canvas.h"
+#include "frame_sink.h"
 
+#define QR_MAX_VERSION  10  // 57x57 modules, 213 bytes at level M
+#define QR_MAX_SIZE     (QR_MAX_VERSION * 4 + 17)
+#define QR_MAX_MODULES  (QR_MAX_SIZE * QR_MAX_SIZE)
+#define QR_QUIET_ZONE   4   // Light modules the code needs around it
+
+// QR code encoder (ISO/IEC 18004): byte mode, error correction level M,
+// smallest version that fits, best of the eight masks. Modules come out
+// one byte each, row-major, 1 for dark.
 class QRCode {
 public:
-    QRCode();
-    ~QRCode();
+    // Returns the side length in modules, or 0 when the text does not fit
+    static int encode(const char* text, uint8_t* modules);
     
-    // Generate QR code for WiFi network connection
-    // Format: WIFI:T:WPA;S:SSID;P:PASSWORD;H:false;;
-    static void generateWiFiQR(const char* ssid, const char* password, uint8_t* qrData, int size);
+    // Join-network code: WIFI:T:WPA;S:<ssid>;P:<password>;;
+    static int generateWiFiQR(const char* ssid, const char* password, uint8_t* modules);
+    static int generateUrlQR(const char* url, uint8_t* modules);
     
-    // Generate QR code for URL
-    static void generateUrlQR(const char* url, uint8_t* qrData, int size);
+    // Draw QR data onto the canvas, centered on (centerX, centerY)
+    static void convertToEPaperFormat(const uint8_t* qrData, int qrSize,
+                                     Canvas& canvas, int centerX, int centerY, int scale);
+};
+
+// Paints a QR code into a frame on its way to the panel, so a screen
+// streamed from flash gets its code without a frame buffer
+class QROverlay : public FrameSink {
+public:
+    QROverlay();
     
-    // Simple QR code generation for basic text
-    static void generateSimpleQR(const char* text, uint8_t* qrData, int size);
+    void setOutput(FrameSink* sink) { output = sink; }
+    // modules must stay valid while frames pass through
+    void setCode(const uint8_t* modules, int size, int centerX, int centerY, int scale);
     
-    // Convert QR data to e-paper display format
-    static void convertToEPaperFormat(const uint8_t* qrData, int qrSize, 
-                                     uint8_t* epaperData, int centerX, int centerY, int scale);
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
 
 private:
-    // Simple pattern generation for basic QR codes
-    static void createFinderPattern(uint8_t* data, int size, int x, int y);
-    static void createTimingPattern(uint8_t* data, int size);
-    static void addQuietZone(uint8_t* data, int size);
+    FrameSink* output;
+    const uint8_t* modules;
+    int size;
+    int left;
+    int top;
+    int scale;
+    size_t position;  // Frame offset of the next byte
+    uint8_t buffer[DISPLAY_ROW_BYTES];
+    
+    void paint(uint8_t* data, size_t offset, size_t length) const;
 };
 
 #endif // QR_CODE_H
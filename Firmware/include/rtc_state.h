@@ -0,0 +1,70 @@
+#ifndef RTC_STATE_H
+#define RTC_STATE_H
+
+#include <stdint.h>
+
+#define RTC_STATE_MAGIC     0x52544331  // "RTC1" - bump when the layout changes
+#define RTC_ETAG_LENGTH     72
+
+// State that has to survive deep sleep. It lives in RTC slow memory, which is
+// kept across timer wakeups but lost on power loss or a cold reset.
+struct RtcState {
+    uint32_t magic;
+    uint32_t size;
+    uint32_t wakeCount;             // Timer wakeups since the last cold boot
+    uint32_t consecutiveFailures;   // Failed update cycles in a row
+    uint32_t backoffSeconds;        // Exponential backoff base after the last failure
+    uint32_t retryDelaySeconds;     // Jittered sleep chosen for the pending retry
+    uint32_t lastSuccessEpoch;      // Wall clock of the last completed update
+    uint32_t lastClockSyncEpoch;    // Wall clock of the last SNTP sync
+    
+    // Validator of the frame on the panel (NVS holds the durable copy)
+    uint32_t etagUrlHash;
+    char etag[RTC_ETAG_LENGTH];
+    
+    // Last successful association, reused to skip the scan and DHCP
+    uint32_t wifiCredentialHash;    // SSID + password the cache belongs to
+    uint32_t wifiCacheUses;         // Fast reconnects since the last DHCP lease
+    uint8_t wifiBssid[6];
+    uint8_t wifiChannel;
+    uint8_t wifiCacheValid;
+    uint32_t wifiIP;
+    uint32_t wifiGateway;
+    uint32_t wifiSubnet;
+    uint32_t wifiDNS;
+    
+    // Next scheduled generation announced by the manifest, 0 if unknown
+    uint32_t nextServerUpdateEpoch;
+    
+    // Whether the panel shows the cached frame (cleared by status screens and
+    // unknown after a cold boot)
+    uint8_t panelShowsFrame;
+    uint32_t overlayCrc;            // Weather band drawn over it, 0 for none
+    uint32_t overlayDrawnEpoch;     // Clock shown in the band, 0 for none
+    int8_t overlayTemperature;      // Weather shown in the band
+    uint8_t overlayHasWeather;
+    char overlayIcon[4];
+    
+    // Playlist rotation between server updates
+    uint32_t refreshCountdownS;     // Sleep left before the next network update
+    uint32_t playlistShownCrc;      // Frame of the view on the panel
+    uint8_t playlistView;           // View on the panel
+    uint8_t rotationPending;        // The last sleep lasted a full dwell
+    
+    uint32_t lastOtaCheckEpoch;     // Last firmware manifest request, 1 if the clock was unset
+    
+    // Adaptive update policy, smoothed over recent wakes (0 until measured)
+    int16_t policyRssi;             // dBm
+    uint16_t policyKBps;            // Download throughput
+    uint16_t batteryMv;             // This wake's reading, 0 without a divider
+    uint8_t policyWeakLink;
+    uint8_t policyBattery;          // BatteryLevel
+};
+
+extern RtcState rtcState;
+
+// Validates RTC memory after boot; returns true if the state survived
+bool rtcStateBegin();
+void rtcStateReset();
+
+#endif // RTC_STATE_H
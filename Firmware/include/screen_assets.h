@@ -0,0 +1,2099 @@
+// Generated by scripts/bake_screens.py - do not edit
+#ifndef SCREEN_ASSETS_H
+#define SCREEN_ASSETS_H
+
+#include <Arduino.h>
+
+// Smart Dashboard Setup: 9939 bytes
+static const uint8_t SCREEN_CONFIG[] PROGMEM = {
+    0x45, 0x50, 0x44, 0x46, 0x01, 0x01, 0x00, 0x00, 0x20, 0x03, 0xE0, 0x01, 0x00, 0xEE, 0x02, 0x00,
+    0xBB, 0x26, 0x00, 0x00, 0xB9, 0x28, 0xEF, 0x8B, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0x8E, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x9A, 0x11, 0x01, 0x10, 0x00, 0x8C,
+    0x11, 0x81, 0x00, 0x00, 0x01, 0x93, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00, 0x01, 0xA5,
+    0x11, 0x01, 0x00, 0x01, 0x88, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x88, 0x11, 0x01, 0x10,
+    0x00, 0xFF, 0x11, 0xE7, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x9A, 0x11, 0x01, 0x10, 0x00,
+    0x8C, 0x11, 0x81, 0x00, 0x00, 0x01, 0x93, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00, 0x01,
+    0xA5, 0x11, 0x01, 0x00, 0x01, 0x88, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x88, 0x11, 0x01,
+    0x10, 0x00, 0xFF, 0x11, 0xE7, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x9A, 0x11, 0x01, 0x10,
+    0x00, 0x8C, 0x11, 0x81, 0x00, 0x00, 0x01, 0x93, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00,
+    0x01, 0xA5, 0x11, 0x01, 0x00, 0x01, 0x88, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x88, 0x11,
+    0x01, 0x10, 0x00, 0xFF, 0x11, 0xE6, 0x11, 0x01, 0x00, 0x01, 0xA0, 0x11, 0x01, 0x10, 0x00, 0x8C,
+    0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x92, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x01,
+    0x00, 0x01, 0xA5, 0x11, 0x01, 0x00, 0x01, 0x87, 0x11, 0x01, 0x00, 0x01, 0x8E, 0x11, 0x01, 0x10,
+    0x00, 0xFF, 0x11, 0xE6, 0x11, 0x01, 0x00, 0x01, 0xA0, 0x11, 0x01, 0x10, 0x00, 0x8C, 0x11, 0x05,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x92, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00, 0x01,
+    0xA5, 0x11, 0x01, 0x00, 0x01, 0x87, 0x11, 0x01, 0x00, 0x01, 0x8E, 0x11, 0x01, 0x10, 0x00, 0xFF,
+    0x11, 0xE6, 0x11, 0x01, 0x00, 0x01, 0xA0, 0x11, 0x01, 0x10, 0x00, 0x8C, 0x11, 0x05, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x92, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00, 0x01, 0xA5, 0x11,
+    0x01, 0x00, 0x01, 0x87, 0x11, 0x01, 0x00, 0x01, 0x8E, 0x11, 0x01, 0x10, 0x00, 0xFF, 0x11, 0xE6,
+    0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x80, 0x00, 0x02, 0x11, 0x10, 0x00, 0x81, 0x11, 0x00, 0x10,
+    0x81, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x81, 0x00, 0x00, 0x01,
+    0x8A, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x81,
+    0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x02,
+    0x00, 0x01, 0x11, 0x80, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81,
+    0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x81, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x87, 0x11, 0x01, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11,
+    0x81, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x02, 0x00, 0x01, 0x11, 0x83,
+    0x00, 0xFF, 0x11, 0xD1, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x80, 0x00, 0x02, 0x11, 0x10, 0x00,
+    0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11,
+    0x81, 0x00, 0x00, 0x01, 0x8A, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x81, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80,
+    0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x81,
+    0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x81, 0x11, 0x06,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x87, 0x11, 0x01, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10,
+    0x81, 0x00, 0x80, 0x11, 0x81, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x02,
+    0x00, 0x01, 0x11, 0x83, 0x00, 0xFF, 0x11, 0xD1, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x80, 0x00,
+    0x02, 0x11, 0x10, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11,
+    0x80, 0x00, 0x80, 0x11, 0x81, 0x00, 0x00, 0x01, 0x8A, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x02,
+    0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x81, 0x11, 0x00,
+    0x10, 0x81, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80,
+    0x00, 0x81, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x87, 0x11, 0x01, 0x00, 0x01,
+    0x85, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x81, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00,
+    0x01, 0x81, 0x11, 0x02, 0x00, 0x01, 0x11, 0x83, 0x00, 0xFF, 0x11, 0xD2, 0x11, 0x00, 0x10, 0x81,
+    0x00, 0x80, 0x11, 0x07, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x84, 0x11, 0x02, 0x00,
+    0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x8C, 0x11, 0x01,
+    0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x84,
+    0x11, 0x80, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x04, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00,
+    0x80, 0x11, 0x0A, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x88, 0x11,
+    0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x05, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x83, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81,
+    0x11, 0x01, 0x00, 0x01, 0xFF, 0x11, 0xD0, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x07, 0x00,
+    0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x84, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80,
+    0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x8C, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01,
+    0x00, 0x01, 0x84, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x84, 0x11, 0x80, 0x00, 0x80, 0x11,
+    0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11,
+    0x01, 0x00, 0x01, 0x84, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x0A, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x88, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x83, 0x11, 0x01,
+    0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0xFF,
+    0x11, 0xD0, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x07, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11,
+    0x00, 0x01, 0x84, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x05, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x8C, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x04,
+    0x00, 0x01, 0x11, 0x00, 0x01, 0x84, 0x11, 0x80, 0x00, 0x80, 0x11, 0x02, 0x00, 0x01, 0x11, 0x80,
+    0x00, 0x80, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11,
+    0x02, 0x00, 0x01, 0x11, 0x80, 0x00, 0x80, 0x11, 0x0A, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x88, 0x11, 0x00, 0x10, 0x81, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x81,
+    0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x83, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04,
+    0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0xFF, 0x11, 0xD5, 0x11, 0x0D, 0x00,
+    0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03,
+    0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x00, 0x8C, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11,
+    0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00,
+    0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01,
+    0x11, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x8D, 0x11, 0x02,
+    0x00, 0x01, 0x11, 0x84, 0x00, 0x04, 0x01, 0x11, 0x11, 0x10, 0x00, 0x83, 0x11, 0x01, 0x00, 0x01,
+    0x81, 0x11, 0x02, 0x00, 0x01, 0x11, 0x83, 0x00, 0xFF, 0x11, 0xD7, 0x11, 0x0D, 0x00, 0x01, 0x11,
+    0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01, 0x11,
+    0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x00, 0x8C, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x80, 0x11, 0x01,
+    0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11,
+    0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01, 0x11, 0x00,
+    0x01, 0x84, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x8D, 0x11, 0x02, 0x00, 0x01,
+    0x11, 0x84, 0x00, 0x04, 0x01, 0x11, 0x11, 0x10, 0x00, 0x83, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11,
+    0x02, 0x00, 0x01, 0x11, 0x83, 0x00, 0xFF, 0x11, 0xD7, 0x11, 0x0D, 0x00, 0x01, 0x11, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01, 0x11, 0x00, 0x01,
+    0x85, 0x11, 0x01, 0x10, 0x00, 0x8C, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x82, 0x00, 0x03, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01,
+    0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01,
+    0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01, 0x11, 0x00, 0x01, 0x84,
+    0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x8D, 0x11, 0x02, 0x00, 0x01, 0x11, 0x84,
+    0x00, 0x04, 0x01, 0x11, 0x11, 0x10, 0x00, 0x83, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x02, 0x00,
+    0x01, 0x11, 0x83, 0x00, 0xFF, 0x11, 0xD7, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11,
+    0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11,
+    0x01, 0x10, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x87, 0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x04, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x8D, 0x11, 0x04,
+    0x00, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x00, 0x80, 0x11, 0x0D, 0x00, 0x01, 0x11,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xFF, 0x11, 0xDB, 0x11, 0x04,
+    0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04,
+    0x00, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x87,
+    0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01,
+    0x00, 0x01, 0x84, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11,
+    0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11,
+    0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x84, 0x11, 0x01, 0x00, 0x01, 0x81,
+    0x11, 0x01, 0x00, 0x01, 0x8D, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10,
+    0x00, 0x80, 0x11, 0x0D, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x00, 0x01, 0xFF, 0x11, 0xDB, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00,
+    0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10,
+    0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x87, 0x11, 0x05, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x84, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00,
+    0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00,
+    0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x00,
+    0x01, 0x84, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x01, 0x00, 0x01, 0x8D, 0x11, 0x04, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x00, 0x80, 0x11, 0x0D, 0x00, 0x01, 0x11, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0xFF, 0x11, 0xD5, 0x11, 0x83, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01,
+    0x11, 0x00, 0x01, 0x87, 0x11, 0x80, 0x00, 0x89, 0x11, 0x81, 0x00, 0x00, 0x01, 0x82, 0x11, 0x00,
+    0x10, 0x82, 0x00, 0x01, 0x01, 0x11, 0x83, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x02,
+    0x00, 0x01, 0x11, 0x83, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x81, 0x11, 0x00, 0x10, 0x82,
+    0x00, 0x03, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x87, 0x11,
+    0x83, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x83, 0x11, 0x80, 0x00, 0x81, 0x11, 0x09, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0xFF, 0x11, 0xD5, 0x11, 0x83, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01,
+    0x11, 0x00, 0x01, 0x87, 0x11, 0x80, 0x00, 0x89, 0x11, 0x81, 0x00, 0x00, 0x01, 0x82, 0x11, 0x00,
+    0x10, 0x82, 0x00, 0x01, 0x01, 0x11, 0x83, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x02,
+    0x00, 0x01, 0x11, 0x83, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x81, 0x11, 0x00, 0x10, 0x82,
+    0x00, 0x03, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x87, 0x11,
+    0x83, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x83, 0x11, 0x80, 0x00, 0x81, 0x11, 0x09, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0xFF, 0x11, 0xD5, 0x11, 0x83, 0x00, 0x80,
+    0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x04, 0x00, 0x01, 0x11, 0x11, 0x10, 0x82, 0x00, 0x03, 0x01,
+    0x11, 0x00, 0x01, 0x87, 0x11, 0x80, 0x00, 0x89, 0x11, 0x81, 0x00, 0x00, 0x01, 0x82, 0x11, 0x00,
+    0x10, 0x82, 0x00, 0x01, 0x01, 0x11, 0x83, 0x00, 0x80, 0x11, 0x01, 0x00, 0x01, 0x81, 0x11, 0x02,
+    0x00, 0x01, 0x11, 0x83, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x81, 0x11, 0x00, 0x10, 0x82,
+    0x00, 0x03, 0x01, 0x11, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x82, 0x00, 0x00, 0x01, 0x87, 0x11,
+    0x83, 0x00, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x83, 0x11, 0x80, 0x00, 0x81, 0x11, 0x09, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xB1, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11,
+    0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x96, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80,
+    0x00, 0x00, 0x01, 0x94, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0xB1, 0x11, 0x01,
+    0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x04, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF,
+    0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x96, 0x11,
+    0x05, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x94, 0x11, 0x01, 0x10, 0x01,
+    0x8A, 0x11, 0x01, 0x10, 0x01, 0xB1, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x8C,
+    0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x81,
+    0x00, 0x04, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xC2, 0x11, 0x02, 0x10, 0x00, 0x01, 0x8B,
+    0x11, 0x01, 0x10, 0x01, 0x99, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x93, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0xB1, 0x11, 0x01,
+    0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x83, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xCA, 0x11, 0x02, 0x10, 0x00, 0x01, 0x8B, 0x11, 0x01,
+    0x10, 0x01, 0x99, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x93, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0xB1, 0x11, 0x01, 0x10, 0x01,
+    0x87, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11,
+    0x01, 0x10, 0x01, 0xFF, 0x11, 0xCB, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x82,
+    0x11, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10,
+    0x00, 0x01, 0x84, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x84, 0x11, 0x15, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x03, 0x10, 0x00, 0x00,
+    0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x26, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x85, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01,
+    0x84, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x82, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11,
+    0x01, 0x10, 0x01, 0x82, 0x11, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x15, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11,
+    0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x26, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03,
+    0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x82, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01,
+    0x10, 0x01, 0x8C, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x85, 0x11, 0x07, 0x10,
+    0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x19, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x82,
+    0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x83, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10,
+    0x01, 0x8C, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x85, 0x11, 0x07, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11,
+    0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10,
+    0x01, 0x81, 0x11, 0x19, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11,
+    0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x83, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01,
+    0x8F, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x00, 0x10, 0x80, 0x00, 0x06, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01,
+    0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01,
+    0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11,
+    0x12, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x02, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x87,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0D,
+    0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11,
+    0x01, 0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x8F, 0x11, 0x03, 0x10, 0x01, 0x10,
+    0x01, 0x82, 0x11, 0x00, 0x10, 0x80, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83,
+    0x11, 0x09, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10,
+    0x01, 0x81, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x81, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x12, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00,
+    0x02, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11,
+    0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0D, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xC3,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x89, 0x11, 0x13, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x83, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84,
+    0x11, 0x13, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x19, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x84, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11,
+    0x0D, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83,
+    0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00,
+    0x01, 0x89, 0x11, 0x13, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x13, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x0A,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x19, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0D, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xC2, 0x11, 0x08,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x09,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x06, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x84, 0x11, 0x0C, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x21, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10,
+    0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11,
+    0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82,
+    0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xC1, 0x11, 0x08, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x09, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84,
+    0x11, 0x0A, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0C,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x05,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x85, 0x11, 0x21, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x86, 0x11, 0x08,
+    0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x03, 0x10, 0x00, 0x00,
+    0x01, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xD7, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01,
+    0x8B, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x96, 0x11, 0x01, 0x10, 0x01, 0xAC, 0x11, 0x01, 0x10,
+    0x01, 0x8E, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x09, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11,
+    0xDA, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x8B, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x96, 0x11,
+    0x01, 0x10, 0x01, 0xAC, 0x11, 0x01, 0x10, 0x01, 0x8E, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x09,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0x81,
+    0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01,
+    0x86, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xD9, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x89, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x95, 0x11, 0x01, 0x10, 0x01, 0xAC, 0x11,
+    0x01, 0x10, 0x01, 0x8D, 0x11, 0x10, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01,
+    0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x02, 0x10, 0x00,
+    0x01, 0x85, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0xD9, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x89, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x95, 0x11, 0x01, 0x10, 0x01,
+    0xAC, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x10, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x02,
+    0x10, 0x00, 0x01, 0x85, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0xDD, 0x11, 0x01, 0x10, 0x01,
+    0x89, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x80, 0x00, 0x0C, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x28, 0x10, 0x01, 0x10,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03,
+    0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x85, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81,
+    0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x86,
+    0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDD, 0x11, 0x01, 0x10, 0x01, 0x89, 0x11, 0x06, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x80, 0x00, 0x0C, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x28, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0x84, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x86,
+    0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10,
+    0x01, 0x85, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x84, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0xFF,
+    0x11, 0xDC, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x17, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x83, 0x11, 0x19, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11,
+    0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01,
+    0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01,
+    0x80, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x86, 0x11, 0x04,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x06, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84,
+    0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDC, 0x11,
+    0x01, 0x10, 0x01, 0x8A, 0x11, 0x17, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11,
+    0x19, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80,
+    0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x00,
+    0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x86, 0x11, 0x04, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x80, 0x00, 0x06, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x04, 0x10,
+    0x01, 0x11, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDB, 0x11, 0x01, 0x10, 0x01,
+    0x8B, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11, 0x10,
+    0x81, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x07, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x12, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x81, 0x00, 0x02, 0x01, 0x10,
+    0x01, 0x88, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85,
+    0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x87, 0x11, 0x0F,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x83, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDB,
+    0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x80, 0x00,
+    0x02, 0x01, 0x11, 0x10, 0x81, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11,
+    0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x12, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x81,
+    0x00, 0x02, 0x01, 0x10, 0x01, 0x88, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x87, 0x11, 0x0F, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10,
+    0x01, 0xFF, 0x11, 0xDA, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x02, 0x10, 0x00, 0x01, 0x85, 0x11,
+    0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11,
+    0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x81, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x88, 0x11, 0x0A,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01,
+    0x82, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x02, 0x10, 0x00, 0x01, 0x81,
+    0x11, 0x13, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x82, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01,
+    0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDA, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x02, 0x10,
+    0x00, 0x01, 0x85, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x07, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10,
+    0x01, 0x88, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85,
+    0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x02,
+    0x10, 0x00, 0x01, 0x81, 0x11, 0x13, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x82, 0x11, 0x06, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xD9, 0x11, 0x00, 0x10, 0x81,
+    0x00, 0x04, 0x01, 0x11, 0x10, 0x00, 0x01, 0x86, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x82, 0x11, 0x0A, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83,
+    0x11, 0x00, 0x10, 0x80, 0x00, 0x03, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x0B, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x80, 0x00, 0x09, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x89, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x85, 0x11, 0x0B, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x81, 0x00, 0x04, 0x01, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x14, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x01, 0x82, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00,
+    0x00, 0x01, 0xFF, 0x11, 0xD8, 0x11, 0x00, 0x10, 0x81, 0x00, 0x04, 0x01, 0x11, 0x10, 0x00, 0x01,
+    0x86, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x0A, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x00, 0x10, 0x80, 0x00, 0x03, 0x01,
+    0x11, 0x10, 0x01, 0x82, 0x11, 0x0B, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x10, 0x80, 0x00, 0x09, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x89,
+    0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x0B, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x04, 0x01, 0x11, 0x10,
+    0x00, 0x01, 0x80, 0x11, 0x14, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x82, 0x11, 0x06, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xEE, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x8A, 0x11, 0x03, 0x10, 0x00,
+    0x00, 0x01, 0x8C, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0xC8, 0x11, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xFF, 0x11,
+    0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x8A, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x8C,
+    0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0xC8, 0x11, 0x01, 0x10, 0x01, 0x81,
+    0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xFF, 0x11, 0x84, 0x11, 0x01,
+    0x10, 0x01, 0x8A, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x8A, 0x11, 0x04, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x84, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x11, 0x01, 0x10, 0x01,
+    0x81, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF8,
+    0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x8A, 0x11, 0x04,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x11, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0xFF,
+    0x11, 0xF7, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x0D, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x1B, 0x10,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x16, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x00, 0x01, 0x85, 0x11, 0x14, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x15,
+    0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF2, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x01,
+    0x10, 0x01, 0x82, 0x11, 0x0D, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x81, 0x11, 0x1B, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x84, 0x11, 0x16, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x01, 0x85, 0x11, 0x14, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x15, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF3,
+    0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0F, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 0x01, 0x81, 0x11, 0x1B, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x17, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x08, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0xFF, 0x11, 0xF6, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0F,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00, 0x01,
+    0x81, 0x11, 0x1B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83,
+    0x11, 0x17, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0x81,
+    0x11, 0x08, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01,
+    0x82, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xF7, 0x11, 0x01, 0x10, 0x01, 0x89, 0x11, 0x01, 0x10,
+    0x01, 0x81, 0x11, 0x0E, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x00, 0x10, 0x80, 0x00, 0x08, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01,
+    0x84, 0x11, 0x00, 0x10, 0x80, 0x00, 0x0E, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x81,
+    0x00, 0x03, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x0B, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0xFF, 0x11, 0xF4, 0x11, 0x01, 0x10, 0x01, 0x89, 0x11, 0x01, 0x10, 0x01, 0x81,
+    0x11, 0x0E, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10,
+    0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x00, 0x10, 0x80, 0x00, 0x08, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x84, 0x11,
+    0x00, 0x10, 0x80, 0x00, 0x0E, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x81, 0x00, 0x03,
+    0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0xFF, 0x11, 0xF0, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01,
+    0x85, 0x11, 0x14, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x09,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x8B,
+    0x11, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01,
+    0x10, 0x01, 0x8B, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x16, 0x10, 0x01, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xEF,
+    0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x85, 0x11, 0x14, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x0F, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x8B, 0x11,
+    0x03, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x16, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81,
+    0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xF0, 0x11, 0x08, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x86, 0x11, 0x13, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11,
+    0x12, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01,
+    0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x12, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x87, 0x11, 0x00, 0x10, 0x80, 0x00, 0x06, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80,
+    0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x16, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x11, 0xF1, 0x11, 0x08, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x01, 0x86, 0x11, 0x13, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x12, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11,
+    0x03, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x12, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x87, 0x11, 0x00, 0x10, 0x80,
+    0x00, 0x06, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80,
+    0x11, 0x16, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xE4, 0x11,
+};
+#define SCREEN_CONFIG_SIZE 9939
+
+// WiFi Connection Failed: 10056 bytes
+static const uint8_t SCREEN_WIFI_FAILED[] PROGMEM = {
+    0x45, 0x50, 0x44, 0x46, 0x01, 0x01, 0x00, 0x00, 0x20, 0x03, 0xE0, 0x01, 0x00, 0xEE, 0x02, 0x00,
+    0x30, 0x27, 0x00, 0x00, 0xA8, 0x14, 0x34, 0x24, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0x88, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x00, 0x14, 0x84, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x8C, 0x11, 0x81, 0x44,
+    0x00, 0x41, 0xAE, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14, 0x44, 0x9C, 0x11, 0x00, 0x14,
+    0x84, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x80, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44,
+    0xFF, 0x11, 0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x00, 0x14, 0x84, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x8C, 0x11, 0x81, 0x44,
+    0x00, 0x41, 0xAE, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14, 0x44, 0x9C, 0x11, 0x00, 0x14,
+    0x84, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x80, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44,
+    0xFF, 0x11, 0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x00, 0x14, 0x84, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x8C, 0x11, 0x81, 0x44,
+    0x00, 0x41, 0xAE, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14, 0x44, 0x9C, 0x11, 0x00, 0x14,
+    0x84, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x80, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44,
+    0xFF, 0x11, 0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14,
+    0x44, 0x96, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xAD, 0x11, 0x01, 0x44, 0x41,
+    0xA6, 0x11, 0x01, 0x14, 0x44, 0x99, 0x11, 0x01, 0x14, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44, 0xFF,
+    0x11, 0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44,
+    0x96, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xAD, 0x11, 0x01, 0x44, 0x41, 0xA6,
+    0x11, 0x01, 0x14, 0x44, 0x99, 0x11, 0x01, 0x14, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11,
+    0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x96,
+    0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xAD, 0x11, 0x01, 0x44, 0x41, 0xA6, 0x11,
+    0x01, 0x14, 0x44, 0x99, 0x11, 0x01, 0x14, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xC6,
+    0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x86, 0x11, 0x80, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x12,
+    0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x44, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x03, 0x41, 0x11,
+    0x11, 0x14, 0x81, 0x44, 0x83, 0x11, 0x80, 0x44, 0x83, 0x11, 0x81, 0x44, 0x09, 0x41, 0x11, 0x11,
+    0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x88, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44,
+    0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x81, 0x44, 0x00,
+    0x41, 0x81, 0x11, 0x80, 0x44, 0x02, 0x11, 0x14, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x01, 0x14, 0x44,
+    0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11,
+    0x80, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x12, 0x41, 0x11, 0x11, 0x14,
+    0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x81,
+    0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x03, 0x41, 0x11, 0x11, 0x14, 0x81, 0x44,
+    0x83, 0x11, 0x80, 0x44, 0x83, 0x11, 0x81, 0x44, 0x09, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x44, 0x41, 0x88, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11,
+    0x80, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x80,
+    0x44, 0x02, 0x11, 0x14, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0x80, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x80, 0x44, 0x8A, 0x11,
+    0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x12, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00,
+    0x41, 0x81, 0x11, 0x81, 0x44, 0x03, 0x41, 0x11, 0x11, 0x14, 0x81, 0x44, 0x83, 0x11, 0x80, 0x44,
+    0x83, 0x11, 0x81, 0x44, 0x09, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x88,
+    0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x84, 0x11,
+    0x01, 0x14, 0x44, 0x83, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x02, 0x11, 0x14,
+    0x44, 0xFF, 0x11, 0xC6, 0x11, 0x07, 0x14, 0x44, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11,
+    0x01, 0x14, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x8A, 0x11,
+    0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x16, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x86, 0x11, 0x01, 0x44, 0x41, 0x85,
+    0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x0A, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x87, 0x11, 0x00, 0x14, 0x81, 0x44, 0x87, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x80, 0x11, 0x80, 0x44, 0xFF, 0x11, 0xC6,
+    0x11, 0x07, 0x14, 0x44, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x00, 0x14, 0x81, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x84,
+    0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x16, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11,
+    0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11,
+    0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x86, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14, 0x44,
+    0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x0A, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x87, 0x11, 0x00, 0x14, 0x81, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11,
+    0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04,
+    0x14, 0x44, 0x11, 0x14, 0x44, 0x80, 0x11, 0x80, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x07, 0x14, 0x44,
+    0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81,
+    0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44,
+    0x81, 0x11, 0x16, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x86, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x0A, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x87,
+    0x11, 0x00, 0x14, 0x81, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84,
+    0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x80, 0x11, 0x80, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x07, 0x14, 0x44, 0x11, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14,
+    0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44,
+    0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x03, 0x14, 0x44,
+    0x11, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x86, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81,
+    0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x00, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x07, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01,
+    0x14, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14,
+    0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x03, 0x14,
+    0x44, 0x11, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x86, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11,
+    0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x81, 0x11,
+    0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x00, 0x14, 0x84, 0x44, 0x02, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x07, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11,
+    0x01, 0x14, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04,
+    0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x03,
+    0x14, 0x44, 0x11, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x86, 0x11, 0x01, 0x44, 0x41, 0x85,
+    0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x81,
+    0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x00, 0x14, 0x84, 0x44, 0x02,
+    0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x04, 0x14, 0x44, 0x44,
+    0x41, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11,
+    0x01, 0x14, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x80, 0x11, 0x05, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44,
+    0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44,
+    0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xC6, 0x11, 0x04, 0x14,
+    0x44, 0x44, 0x41, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44,
+    0x87, 0x11, 0x01, 0x14, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x05, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81,
+    0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11,
+    0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xC6, 0x11,
+    0x04, 0x14, 0x44, 0x44, 0x41, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14,
+    0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14,
+    0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x05, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81,
+    0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44,
+    0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11,
+    0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x04, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x00, 0x41, 0x8A, 0x11, 0x81, 0x44, 0x00, 0x41,
+    0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81,
+    0x44, 0x00, 0x41, 0x82, 0x11, 0x03, 0x14, 0x44, 0x44, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41,
+    0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87,
+    0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11,
+    0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x83, 0x44, 0xFF, 0x11,
+    0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x04, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x00, 0x41, 0x8A, 0x11, 0x81, 0x44, 0x00, 0x41,
+    0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81,
+    0x44, 0x00, 0x41, 0x82, 0x11, 0x03, 0x14, 0x44, 0x44, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41,
+    0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87,
+    0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11,
+    0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x83, 0x44, 0xFF, 0x11,
+    0xC6, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x04, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x00, 0x41, 0x8A, 0x11, 0x81, 0x44, 0x00, 0x41,
+    0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81,
+    0x44, 0x00, 0x41, 0x82, 0x11, 0x03, 0x14, 0x44, 0x44, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41,
+    0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87,
+    0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11,
+    0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x83, 0x44, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xA7, 0x11,
+    0x01, 0x10, 0x01, 0x8C, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x96, 0x11, 0x05, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x94, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01,
+    0x10, 0x01, 0xB1, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x0C, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x04, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x00, 0x10, 0x80,
+    0x00, 0x00, 0x01, 0x96, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01,
+    0x94, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0xB1, 0x11, 0x01, 0x10, 0x01, 0x87,
+    0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x04, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xC2, 0x11,
+    0x02, 0x10, 0x00, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x99, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x93, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01,
+    0x10, 0x01, 0xB1, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x05, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xCA, 0x11, 0x02, 0x10,
+    0x00, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x99, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x93, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01,
+    0xB1, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x05, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xCB, 0x11, 0x01, 0x10, 0x01, 0x8B,
+    0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x15, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84,
+    0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x26,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11,
+    0x03, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x82, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0xC3, 0x11,
+    0x01, 0x10, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x0B, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x15, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x84, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00,
+    0x01, 0x85, 0x11, 0x26, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x03, 0x10, 0x00,
+    0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x82, 0x11, 0x02, 0x10, 0x00, 0x01,
+    0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x85, 0x11, 0x07, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x06, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x81,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x19, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11,
+    0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF,
+    0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x8C, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01,
+    0x85, 0x11, 0x07, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x06, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x19, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11,
+    0xC3, 0x11, 0x01, 0x10, 0x01, 0x8F, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x00, 0x10,
+    0x80, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x10,
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0C, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01,
+    0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11,
+    0x01, 0x10, 0x01, 0x81, 0x11, 0x12, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x02, 0x01, 0x10, 0x01, 0x82,
+    0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x83, 0x11, 0x0D, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x8F,
+    0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x00, 0x10, 0x80, 0x00, 0x06, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80,
+    0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x12,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x81, 0x00, 0x02, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11,
+    0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0D, 0x10,
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01,
+    0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x89,
+    0x11, 0x13, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x13, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x0A, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x19, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x83, 0x11, 0x0D, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xC3, 0x11, 0x01, 0x10, 0x01,
+    0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x89, 0x11, 0x13, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0A,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x13, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x88, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x83, 0x11, 0x19, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0B,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10,
+    0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0D, 0x10, 0x00, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01,
+    0xFF, 0x11, 0xC2, 0x11, 0x08, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x85, 0x11,
+    0x00, 0x10, 0x80, 0x00, 0x09, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80,
+    0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x00, 0x01, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0C, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x86, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x21, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x84, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xC1, 0x11, 0x08,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x09,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x06, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x84, 0x11, 0x0C, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x21, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10,
+    0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11,
+    0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82,
+    0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xD7, 0x11,
+    0x03, 0x10, 0x00, 0x00, 0x01, 0x8B, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x96, 0x11, 0x01, 0x10,
+    0x01, 0xAC, 0x11, 0x01, 0x10, 0x01, 0x8E, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x09, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x08,
+    0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x86, 0x11,
+    0x01, 0x10, 0x01, 0xFF, 0x11, 0xDA, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x8B, 0x11, 0x03, 0x10,
+    0x00, 0x00, 0x01, 0x96, 0x11, 0x01, 0x10, 0x01, 0xAC, 0x11, 0x01, 0x10, 0x01, 0x8E, 0x11, 0x01,
+    0x10, 0x01, 0x80, 0x11, 0x09, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86,
+    0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x87, 0x11, 0x01, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xD9, 0x11, 0x05, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x89, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x95, 0x11,
+    0x01, 0x10, 0x01, 0xAC, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x10, 0x10, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x02, 0x10,
+    0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x85, 0x11, 0x02, 0x10, 0x00, 0x01, 0x85, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0xD9, 0x11,
+    0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x89, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x95, 0x11, 0x01, 0x10, 0x01, 0xAC, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x10, 0x10, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11,
+    0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x85, 0x11, 0x02, 0x10, 0x00, 0x01, 0x85, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11,
+    0xDD, 0x11, 0x01, 0x10, 0x01, 0x89, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x80,
+    0x00, 0x0C, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84,
+    0x11, 0x28, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x03, 0x10, 0x00,
+    0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x85, 0x11, 0x05, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x03,
+    0x10, 0x01, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDD, 0x11, 0x01, 0x10, 0x01,
+    0x89, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x80, 0x00, 0x0C, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x28, 0x10, 0x01, 0x10,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x84, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03,
+    0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x85, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81,
+    0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x86,
+    0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDC, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x17, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x19, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x85, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x01,
+    0x10, 0x01, 0x86, 0x11, 0x04, 0x10, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x06, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10,
+    0x01, 0xFF, 0x11, 0xDC, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x17, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x83, 0x11, 0x19, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x84,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x01,
+    0x10, 0x01, 0x80, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x86,
+    0x11, 0x04, 0x10, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x06, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x84, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11,
+    0xDB, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x80,
+    0x00, 0x02, 0x01, 0x11, 0x10, 0x81, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83,
+    0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x12, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x81, 0x00, 0x02, 0x01, 0x10, 0x01, 0x88, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x87, 0x11, 0x0F, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x85, 0x11, 0x01,
+    0x10, 0x01, 0xFF, 0x11, 0xDB, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11, 0x10, 0x81, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x83, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11,
+    0x12, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x81, 0x00, 0x02, 0x01, 0x10, 0x01, 0x88, 0x11, 0x01, 0x10, 0x01, 0x80,
+    0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x05,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x87, 0x11, 0x0F, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00,
+    0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDA, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x02,
+    0x10, 0x00, 0x01, 0x85, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11,
+    0x01, 0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x07, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01,
+    0x10, 0x01, 0x88, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x85, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11,
+    0x02, 0x10, 0x00, 0x01, 0x81, 0x11, 0x13, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x82, 0x11, 0x06, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xDA, 0x11, 0x01, 0x10,
+    0x01, 0x81, 0x11, 0x02, 0x10, 0x00, 0x01, 0x85, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x83, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0B, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x03, 0x10, 0x01, 0x10,
+    0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x88, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x81, 0x11, 0x02, 0x10, 0x00, 0x01, 0x81, 0x11, 0x13, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x82,
+    0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11,
+    0xD9, 0x11, 0x00, 0x10, 0x81, 0x00, 0x04, 0x01, 0x11, 0x10, 0x00, 0x01, 0x86, 0x11, 0x06, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x0A, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x00, 0x10, 0x80, 0x00, 0x03, 0x01, 0x11, 0x10, 0x01, 0x82,
+    0x11, 0x0B, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x80, 0x00,
+    0x09, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x89, 0x11, 0x08, 0x10, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x0B, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x04, 0x01, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11,
+    0x14, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x82, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01,
+    0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xD8, 0x11, 0x00, 0x10, 0x81, 0x00, 0x04,
+    0x01, 0x11, 0x10, 0x00, 0x01, 0x86, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82,
+    0x11, 0x0A, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x00,
+    0x10, 0x80, 0x00, 0x03, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x0B, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x80, 0x00, 0x09, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x89, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x85, 0x11, 0x0B, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x81,
+    0x00, 0x04, 0x01, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x14, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x82,
+    0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xEE, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01,
+    0x8A, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x8C, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01,
+    0x10, 0x01, 0xC8, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10,
+    0x01, 0xFF, 0x11, 0xFF, 0x11, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x8A, 0x11, 0x03,
+    0x10, 0x00, 0x00, 0x01, 0x8C, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0xC8,
+    0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11,
+    0xFF, 0x11, 0x84, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x8A, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01,
+    0xC0, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x00, 0x10, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0x11, 0xF8, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x8A, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x00, 0x10, 0x80, 0x00,
+    0x00, 0x01, 0xC0, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x00, 0x10,
+    0x80, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF7, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01,
+    0x82, 0x11, 0x0D, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x81, 0x11, 0x1B, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x84, 0x11, 0x16, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x01, 0x85, 0x11, 0x14, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x80, 0x11, 0x15, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF2, 0x11, 0x01,
+    0x10, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x0D, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x1B, 0x10, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x16, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0x85, 0x11, 0x14, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x15, 0x10, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0xFF, 0x11, 0xF3, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11,
+    0x0F, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x00,
+    0x01, 0x81, 0x11, 0x1B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x83, 0x11, 0x17, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83, 0x11, 0x01, 0x10, 0x01,
+    0x81, 0x11, 0x08, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10,
+    0x01, 0x82, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xF6, 0x11, 0x01, 0x10, 0x01, 0x8A, 0x11, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x0F, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x10, 0x00, 0x00, 0x01, 0x81, 0x11, 0x1B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x17, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x83,
+    0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x08, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xF7, 0x11, 0x01, 0x10,
+    0x01, 0x89, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0E, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x00,
+    0x10, 0x80, 0x00, 0x08, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x00,
+    0x10, 0x81, 0x00, 0x00, 0x01, 0x84, 0x11, 0x00, 0x10, 0x80, 0x00, 0x0E, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x05, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x81, 0x00, 0x03, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01,
+    0x82, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x80,
+    0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF4, 0x11, 0x01, 0x10, 0x01, 0x89,
+    0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0E, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x00, 0x10, 0x80,
+    0x00, 0x08, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81, 0x11, 0x00, 0x10, 0x81,
+    0x00, 0x00, 0x01, 0x84, 0x11, 0x00, 0x10, 0x80, 0x00, 0x0E, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x10, 0x81, 0x00, 0x03, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11,
+    0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x80, 0x00, 0x05,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF0, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x00, 0x01, 0x85, 0x11, 0x14, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x01,
+    0x10, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x81,
+    0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11,
+    0x16, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01,
+    0x10, 0x01, 0xFF, 0x11, 0xEF, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x01, 0x85, 0x11, 0x14, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11,
+    0x09, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01,
+    0x8B, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x01, 0x10, 0x01, 0x8B, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x16, 0x10, 0x01, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11,
+    0xF0, 0x11, 0x08, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x86, 0x11, 0x13, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x81, 0x11, 0x12, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01,
+    0x85, 0x11, 0x12, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x87, 0x11, 0x00, 0x10, 0x80, 0x00, 0x06, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x16, 0x10, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xF1, 0x11, 0x08, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x86, 0x11, 0x13, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x12,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10,
+    0x01, 0x10, 0x01, 0x82, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x12, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01,
+    0x87, 0x11, 0x00, 0x10, 0x80, 0x00, 0x06, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11,
+    0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x16, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xE4, 0x11,
+};
+#define SCREEN_WIFI_FAILED_SIZE 10056
+
+// Config Server Failed: 6551 bytes
+static const uint8_t SCREEN_SERVER_FAILED[] PROGMEM = {
+    0x45, 0x50, 0x44, 0x46, 0x01, 0x01, 0x00, 0x00, 0x20, 0x03, 0xE0, 0x01, 0x00, 0xEE, 0x02, 0x00,
+    0x7F, 0x19, 0x00, 0x00, 0xD8, 0xD7, 0x4C, 0xDB, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xD9, 0x11, 0x81, 0x44,
+    0x00, 0x41, 0x94, 0x11, 0x03, 0x14, 0x44, 0x44, 0x41, 0x82, 0x11, 0x01, 0x14, 0x44, 0x95, 0x11,
+    0x83, 0x44, 0xB4, 0x11, 0x00, 0x14, 0x84, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x80,
+    0x44, 0x90, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xDA, 0x11, 0x81, 0x44, 0x00, 0x41, 0x94, 0x11,
+    0x03, 0x14, 0x44, 0x44, 0x41, 0x82, 0x11, 0x01, 0x14, 0x44, 0x95, 0x11, 0x83, 0x44, 0xB4, 0x11,
+    0x00, 0x14, 0x84, 0x44, 0x8A, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x80, 0x44, 0x90, 0x11, 0x01,
+    0x14, 0x44, 0xFF, 0x11, 0xDA, 0x11, 0x81, 0x44, 0x00, 0x41, 0x94, 0x11, 0x03, 0x14, 0x44, 0x44,
+    0x41, 0x82, 0x11, 0x01, 0x14, 0x44, 0x95, 0x11, 0x83, 0x44, 0xB4, 0x11, 0x00, 0x14, 0x84, 0x44,
+    0x8A, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x80, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11,
+    0xD8, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x92, 0x11, 0x05, 0x44, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x89, 0x11, 0x83, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0xBA, 0x11, 0x01, 0x14,
+    0x44, 0x99, 0x11, 0x01, 0x14, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x92, 0x11, 0x05, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44,
+    0x89, 0x11, 0x83, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0xBA, 0x11, 0x01, 0x14, 0x44, 0x99, 0x11,
+    0x01, 0x14, 0x44, 0x90, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x01, 0x14, 0x44, 0x92, 0x11, 0x05, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x89, 0x11, 0x83,
+    0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0xBA, 0x11, 0x01, 0x14, 0x44, 0x99, 0x11, 0x01, 0x14, 0x44,
+    0x90, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44,
+    0x09, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41,
+    0x84, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11,
+    0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x0D, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x09,
+    0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x88, 0x11, 0x01, 0x14, 0x44, 0x86,
+    0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11,
+    0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x02, 0x11, 0x14, 0x44, 0xFF, 0x11, 0xD8, 0x11,
+    0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x09, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44,
+    0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44,
+    0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x0D, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x09, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44,
+    0x41, 0x88, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x80, 0x44,
+    0x84, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x02,
+    0x11, 0x14, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81, 0x44, 0x09, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11,
+    0x80, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14,
+    0x44, 0x86, 0x11, 0x81, 0x44, 0x0D, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x81, 0x44, 0x09, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x88, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x81,
+    0x44, 0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x81, 0x44,
+    0x00, 0x41, 0x81, 0x11, 0x80, 0x44, 0x02, 0x11, 0x14, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14,
+    0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x0C, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x81, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x89, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14,
+    0x44, 0x81, 0x11, 0x0D, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x0A, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x87, 0x11, 0x00, 0x14, 0x81, 0x44, 0x87, 0x11,
+    0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x80, 0x11, 0x80, 0x44, 0xFF, 0x11,
+    0xD8, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x0C, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x81, 0x44, 0x84, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x89, 0x11, 0x81, 0x44, 0x04,
+    0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x0D, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11,
+    0x0A, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x87, 0x11, 0x00, 0x14,
+    0x81, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x80, 0x11,
+    0x80, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11,
+    0x0C, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x81, 0x44,
+    0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x89,
+    0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x0D, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x0A, 0x14, 0x44, 0x11, 0x14, 0x44, 0x44, 0x41, 0x11, 0x11, 0x14, 0x44,
+    0x87, 0x11, 0x00, 0x14, 0x81, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44,
+    0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x80, 0x11, 0x80, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80,
+    0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x83, 0x44, 0x8D, 0x11, 0x03,
+    0x14, 0x44, 0x11, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x03, 0x14, 0x44, 0x11, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14,
+    0x44, 0x86, 0x11, 0x83, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x00, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11,
+    0xD8, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14,
+    0x44, 0x83, 0x11, 0x83, 0x44, 0x8D, 0x11, 0x03, 0x14, 0x44, 0x11, 0x14, 0x84, 0x44, 0x02, 0x11,
+    0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x03, 0x14, 0x44, 0x11, 0x14, 0x84, 0x44,
+    0x02, 0x11, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x81, 0x11, 0x01,
+    0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x00, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80,
+    0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x83, 0x44, 0x8D, 0x11, 0x03,
+    0x14, 0x44, 0x11, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x03, 0x14, 0x44, 0x11, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14,
+    0x44, 0x86, 0x11, 0x83, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81,
+    0x11, 0x00, 0x14, 0x84, 0x44, 0x02, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF, 0x11,
+    0xD8, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x04,
+    0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0x85,
+    0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x8D, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14,
+    0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x08, 0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x11,
+    0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44,
+    0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0xFF,
+    0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11,
+    0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x01, 0x44, 0x41,
+    0x85, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x8D, 0x11, 0x04, 0x14, 0x44, 0x11,
+    0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x08, 0x44, 0x41, 0x11, 0x44, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14,
+    0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44,
+    0xFF, 0x11, 0xD8, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81,
+    0x11, 0x04, 0x14, 0x44, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x01, 0x44,
+    0x41, 0x85, 0x11, 0x01, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x8D, 0x11, 0x04, 0x14, 0x44,
+    0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x08, 0x44, 0x41, 0x11, 0x44, 0x41,
+    0x11, 0x11, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11,
+    0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01,
+    0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x84, 0x11, 0x01, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14,
+    0x44, 0xFF, 0x11, 0xDA, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x81,
+    0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x88, 0x11, 0x00, 0x14, 0x82, 0x44, 0x00,
+    0x41, 0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44,
+    0x83, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14, 0x44, 0x86,
+    0x11, 0x83, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81,
+    0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x83, 0x44, 0xFF, 0x11, 0xDA, 0x11, 0x81, 0x44, 0x00,
+    0x41, 0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44,
+    0x80, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00,
+    0x41, 0x88, 0x11, 0x00, 0x14, 0x82, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44, 0x83, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11,
+    0x14, 0x44, 0x8D, 0x11, 0x01, 0x14, 0x44, 0x86, 0x11, 0x83, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00,
+    0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x83,
+    0x44, 0xFF, 0x11, 0xDA, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11,
+    0x11, 0x14, 0x44, 0x81, 0x11, 0x01, 0x14, 0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x81,
+    0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x88, 0x11, 0x00, 0x14, 0x82, 0x44, 0x00,
+    0x41, 0x81, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x87, 0x11, 0x01, 0x14, 0x44,
+    0x83, 0x11, 0x81, 0x44, 0x04, 0x41, 0x11, 0x11, 0x14, 0x44, 0x8D, 0x11, 0x01, 0x14, 0x44, 0x86,
+    0x11, 0x83, 0x44, 0x80, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x81, 0x44, 0x00, 0x41, 0x81,
+    0x11, 0x81, 0x44, 0x00, 0x41, 0x81, 0x11, 0x83, 0x44, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xB7, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00,
+    0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01,
+    0x80, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x92,
+    0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x01, 0x10, 0x01, 0xA6, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11,
+    0xD9, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x01,
+    0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10,
+    0x01, 0x8B, 0x11, 0x01, 0x10, 0x01, 0x92, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x01, 0x10, 0x01,
+    0xA6, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0xD9, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x8A, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80,
+    0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0xA2, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11,
+    0x01, 0x10, 0x01, 0x99, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xE3, 0x11, 0x05,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x8A, 0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x01, 0x10, 0x01,
+    0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0xA2,
+    0x11, 0x01, 0x10, 0x01, 0x8D, 0x11, 0x01, 0x10, 0x01, 0x99, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00,
+    0x01, 0xFF, 0x11, 0xE3, 0x11, 0x15, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x0E, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11,
+    0x10, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x85, 0x11, 0x14, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x09, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11,
+    0x03, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x1B, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0xFF, 0x11, 0xD2, 0x11, 0x15, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x0E, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x10, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x14, 0x10, 0x00, 0x01,
+    0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10,
+    0x00, 0x01, 0x80, 0x11, 0x09, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84,
+    0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x84, 0x11, 0x1B, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0xFF, 0x11, 0xD2, 0x11, 0x00, 0x10, 0x80, 0x00, 0x09, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x01, 0x10, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0B, 0x10,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x19, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0B, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x87, 0x11, 0x07, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11,
+    0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0xFF,
+    0x11, 0xD1, 0x11, 0x00, 0x10, 0x80, 0x00, 0x09, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0B, 0x10, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x19, 0x10, 0x01, 0x11, 0x10,
+    0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01,
+    0x10, 0x01, 0x80, 0x11, 0x0B, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x87, 0x11, 0x07, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x0D, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xD1,
+    0x11, 0x06, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x09, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x00, 0x10, 0x80, 0x00, 0x02, 0x01, 0x10, 0x01,
+    0x82, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x06, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x83, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x81, 0x00, 0x0E, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10,
+    0x01, 0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80,
+    0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x00, 0x10,
+    0x80, 0x00, 0x02, 0x01, 0x11, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11, 0x10, 0x80, 0x00, 0x0C, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xD1, 0x11,
+    0x06, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x81, 0x00, 0x09, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x00, 0x10, 0x80, 0x00, 0x02, 0x01, 0x10, 0x01, 0x82,
+    0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x83, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x81, 0x00, 0x0E, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x81, 0x11, 0x00, 0x10, 0x81, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01,
+    0x80, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11,
+    0x01, 0x10, 0x01, 0x82, 0x11, 0x00, 0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x00, 0x10, 0x80,
+    0x00, 0x02, 0x01, 0x11, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11, 0x10, 0x80, 0x00, 0x0C, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xD1, 0x11, 0x07,
+    0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x85, 0x11, 0x0F, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x04, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x84, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x87, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x82, 0x11,
+    0x03, 0x10, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0B, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x84, 0x11, 0x06, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10,
+    0x01, 0x83, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x13, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0xFF, 0x11, 0xD1, 0x11, 0x07, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x85, 0x11,
+    0x0F, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x82, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x87, 0x11, 0x07, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x82, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0B, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x88, 0x11, 0x0A, 0x10, 0x01, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x06, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x81, 0x11, 0x13, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xD1, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x05,
+    0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x02, 0x01, 0x10, 0x01, 0x83, 0x11, 0x02, 0x10,
+    0x00, 0x01, 0x86, 0x11, 0x0E, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x05, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11,
+    0x03, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x08, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x0C, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0xD1, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x05, 0x10, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x02, 0x01, 0x10, 0x01, 0x83, 0x11, 0x02, 0x10, 0x00, 0x01,
+    0x86, 0x11, 0x0E, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80,
+    0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x08, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x86, 0x11, 0x05, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x03, 0x10,
+    0x00, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x08, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x80, 0x00, 0x0C, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF,
+    0x11, 0xFF, 0x11, 0xFF, 0x11, 0xB6, 0x11,
+};
+#define SCREEN_SERVER_FAILED_SIZE 6551
+
+// Image Error: 6572 bytes
+static const uint8_t SCREEN_IMAGE_ERROR[] PROGMEM = {
+    0x45, 0x50, 0x44, 0x46, 0x01, 0x01, 0x00, 0x00, 0x20, 0x03, 0xE0, 0x01, 0x00, 0xEE, 0x02, 0x00,
+    0x94, 0x19, 0x00, 0x00, 0x0E, 0xAD, 0x2E, 0x09, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0x02, 0x11,
+    0x11, 0x14, 0x81, 0x44, 0xAD, 0x11, 0x84, 0x44, 0x00, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xCC, 0x11,
+    0x00, 0x14, 0x81, 0x44, 0xAD, 0x11, 0x84, 0x44, 0x00, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xCC, 0x11,
+    0x00, 0x14, 0x81, 0x44, 0xAD, 0x11, 0x84, 0x44, 0x00, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xCE, 0x11,
+    0x01, 0x44, 0x41, 0x94, 0x11, 0x00, 0x14, 0x82, 0x44, 0x00, 0x41, 0x90, 0x11, 0x01, 0x44, 0x41,
+    0xFF, 0x11, 0xFF, 0x11, 0xD4, 0x11, 0x01, 0x44, 0x41, 0x94, 0x11, 0x00, 0x14, 0x82, 0x44, 0x00,
+    0x41, 0x90, 0x11, 0x01, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xD4, 0x11, 0x01, 0x44, 0x41, 0x94,
+    0x11, 0x00, 0x14, 0x82, 0x44, 0x00, 0x41, 0x90, 0x11, 0x01, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11,
+    0xD4, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x80, 0x44, 0x02, 0x11, 0x14, 0x44, 0x81, 0x11, 0x00,
+    0x14, 0x81, 0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x11, 0x14,
+    0x81, 0x44, 0x89, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x80,
+    0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x80, 0x11, 0x02,
+    0x44, 0x41, 0x11, 0x80, 0x44, 0xFF, 0x11, 0xFF, 0x11, 0xAC, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11,
+    0x80, 0x44, 0x02, 0x11, 0x14, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x80, 0x11, 0x01, 0x44,
+    0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x11, 0x14, 0x81, 0x44, 0x89, 0x11, 0x01, 0x44, 0x41,
+    0x84, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x80, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44,
+    0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x80, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0xFF, 0x11,
+    0xFF, 0x11, 0xAC, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x80, 0x44, 0x02, 0x11, 0x14, 0x44, 0x81,
+    0x11, 0x00, 0x14, 0x81, 0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11,
+    0x11, 0x14, 0x81, 0x44, 0x89, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80,
+    0x44, 0x80, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x80,
+    0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0xFF, 0x11, 0xFF, 0x11, 0xAC, 0x11, 0x01, 0x44, 0x41,
+    0x81, 0x11, 0x07, 0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x44, 0x41, 0x84, 0x11, 0x04, 0x44, 0x41,
+    0x11, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41,
+    0x87, 0x11, 0x83, 0x44, 0x80, 0x11, 0x80, 0x44, 0x80, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44,
+    0x80, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44,
+    0x80, 0x11, 0x01, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xAA, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11,
+    0x07, 0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x44, 0x41, 0x84, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44,
+    0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41, 0x87, 0x11,
+    0x83, 0x44, 0x80, 0x11, 0x80, 0x44, 0x80, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x80, 0x11,
+    0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x80, 0x11,
+    0x01, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xAA, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x07, 0x44,
+    0x41, 0x11, 0x44, 0x41, 0x11, 0x44, 0x41, 0x84, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81,
+    0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41, 0x87, 0x11, 0x83, 0x44,
+    0x80, 0x11, 0x80, 0x44, 0x80, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x80, 0x11, 0x04, 0x44,
+    0x41, 0x11, 0x44, 0x41, 0x81, 0x11, 0x02, 0x44, 0x41, 0x11, 0x80, 0x44, 0x80, 0x11, 0x01, 0x44,
+    0x41, 0xFF, 0x11, 0xFF, 0x11, 0xAA, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x0A, 0x44, 0x41, 0x11,
+    0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x11, 0x14, 0x82, 0x44, 0x03, 0x41, 0x11, 0x11, 0x14, 0x82,
+    0x44, 0x01, 0x41, 0x11, 0x84, 0x44, 0x00, 0x41, 0x87, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01,
+    0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44,
+    0x41, 0x11, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xB0, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x0A,
+    0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x11, 0x14, 0x82, 0x44, 0x03, 0x41, 0x11,
+    0x11, 0x14, 0x82, 0x44, 0x01, 0x41, 0x11, 0x84, 0x44, 0x00, 0x41, 0x87, 0x11, 0x01, 0x44, 0x41,
+    0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x81,
+    0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xB0, 0x11, 0x01, 0x44, 0x41,
+    0x81, 0x11, 0x0A, 0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x44, 0x41, 0x11, 0x11, 0x14, 0x82, 0x44,
+    0x03, 0x41, 0x11, 0x11, 0x14, 0x82, 0x44, 0x01, 0x41, 0x11, 0x84, 0x44, 0x00, 0x41, 0x87, 0x11,
+    0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01,
+    0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xB0, 0x11,
+    0x01, 0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41,
+    0x81, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x8D, 0x11, 0x01,
+    0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44,
+    0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xB0, 0x11, 0x01,
+    0x44, 0x41, 0x81, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81,
+    0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x8D, 0x11, 0x01, 0x44,
+    0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41,
+    0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xB0, 0x11, 0x01, 0x44,
+    0x41, 0x81, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x81, 0x11,
+    0x01, 0x44, 0x41, 0x84, 0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0x8D, 0x11, 0x01, 0x44, 0x41,
+    0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x81,
+    0x11, 0x04, 0x44, 0x41, 0x11, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xAE, 0x11, 0x00, 0x14, 0x81,
+    0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x11, 0x14, 0x82, 0x44,
+    0x03, 0x41, 0x11, 0x11, 0x14, 0x81, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x89, 0x11, 0x84,
+    0x44, 0x03, 0x41, 0x11, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x00, 0x14, 0x81,
+    0x44, 0x80, 0x11, 0x01, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xAE, 0x11, 0x00, 0x14, 0x81, 0x44,
+    0x80, 0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x11, 0x14, 0x82, 0x44, 0x03,
+    0x41, 0x11, 0x11, 0x14, 0x81, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x89, 0x11, 0x84, 0x44,
+    0x03, 0x41, 0x11, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x00, 0x14, 0x81, 0x44,
+    0x80, 0x11, 0x01, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xAE, 0x11, 0x00, 0x14, 0x81, 0x44, 0x80,
+    0x11, 0x01, 0x44, 0x41, 0x81, 0x11, 0x04, 0x44, 0x41, 0x11, 0x11, 0x14, 0x82, 0x44, 0x03, 0x41,
+    0x11, 0x11, 0x14, 0x81, 0x44, 0x81, 0x11, 0x00, 0x14, 0x81, 0x44, 0x89, 0x11, 0x84, 0x44, 0x03,
+    0x41, 0x11, 0x44, 0x41, 0x84, 0x11, 0x01, 0x44, 0x41, 0x85, 0x11, 0x00, 0x14, 0x81, 0x44, 0x80,
+    0x11, 0x01, 0x44, 0x41, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xBB, 0x11, 0x00, 0x10, 0x81, 0x00, 0x02, 0x01, 0x10, 0x01, 0x91, 0x11,
+    0x01, 0x10, 0x01, 0x90, 0x11, 0x02, 0x10, 0x00, 0x01, 0x8F, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11,
+    0x01, 0x10, 0x01, 0x85, 0x11, 0x02, 0x10, 0x00, 0x01, 0xA0, 0x11, 0x01, 0x10, 0x01, 0xA2, 0x11,
+    0x01, 0x10, 0x01, 0x88, 0x11, 0x02, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11,
+    0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x05,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x8C, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0x8B, 0x11,
+    0x00, 0x10, 0x81, 0x00, 0x02, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0x90, 0x11, 0x02,
+    0x10, 0x00, 0x01, 0x8F, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x85, 0x11, 0x02,
+    0x10, 0x00, 0x01, 0xA0, 0x11, 0x01, 0x10, 0x01, 0xA2, 0x11, 0x01, 0x10, 0x01, 0x88, 0x11, 0x02,
+    0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01,
+    0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x8C, 0x11, 0x02, 0x10, 0x00, 0x01, 0xFF, 0x11, 0x8D, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0x8F, 0x11, 0x01, 0x10, 0x01,
+    0x87, 0x11, 0x01, 0x10, 0x01, 0x84, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x9F, 0x11, 0x01,
+    0x10, 0x01, 0xA2, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84,
+    0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11,
+    0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0x8D, 0x11, 0x05, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0x8F, 0x11, 0x01,
+    0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x84, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01, 0x9F,
+    0x11, 0x01, 0x10, 0x01, 0xA2, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10,
+    0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01,
+    0x91, 0x11, 0x01, 0x10, 0x01, 0x91, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0x8D, 0x11, 0x0E, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11,
+    0x15, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x1C, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10,
+    0x01, 0x80, 0x11, 0x16, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x15, 0x10, 0x00,
+    0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11,
+    0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x08, 0x10,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x10, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x08, 0x10,
+    0x00, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0A, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0x10, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x15, 0x10,
+    0x00, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x1C, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80,
+    0x11, 0x16, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x15, 0x10, 0x00, 0x01, 0x10,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x84, 0x11, 0x0F, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x86, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x08, 0x10, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x10, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x08, 0x10, 0x00, 0x01,
+    0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x80, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0A, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x23, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x81, 0x11, 0x13, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x83, 0x11, 0x0B, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x81, 0x11, 0x0D, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x13, 0x10, 0x01, 0x11, 0x10,
+    0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x87, 0x11, 0x0E, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x10, 0x01, 0x86, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11,
+    0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x0B, 0x10, 0x00, 0x01, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x07, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0xFF, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x23, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x13, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x10, 0x00, 0x01, 0x83, 0x11, 0x0B, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x01, 0x11,
+    0x10, 0x01, 0x81, 0x11, 0x0D, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x83, 0x11, 0x13, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x87, 0x11, 0x0E, 0x10, 0x00, 0x01,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x86, 0x11, 0x03, 0x10,
+    0x00, 0x00, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01,
+    0x10, 0x01, 0x80, 0x11, 0x0B, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x83, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x10, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x81, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83,
+    0x11, 0x07, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0xFF, 0x11, 0x0C, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x83, 0x11,
+    0x25, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x80, 0x00, 0x07, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x81, 0x00, 0x06, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10,
+    0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x00, 0x10, 0x80, 0x00, 0x07, 0x01, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x83, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x84, 0x11, 0x0E, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11,
+    0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01,
+    0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x00, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11, 0x10, 0x80,
+    0x00, 0x00, 0x01, 0xFF, 0x11, 0x0C, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x83, 0x11, 0x25, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10,
+    0x80, 0x00, 0x07, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x06, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x82,
+    0x11, 0x00, 0x10, 0x80, 0x00, 0x07, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x81, 0x00,
+    0x00, 0x01, 0x83, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x81, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x84, 0x11, 0x0E, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x87, 0x11, 0x01,
+    0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x87, 0x11, 0x01, 0x10,
+    0x01, 0x80, 0x11, 0x06, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x81, 0x00, 0x00, 0x01, 0x83,
+    0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x80, 0x11, 0x05, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11,
+    0x00, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0xFF, 0x11, 0x0D, 0x11,
+    0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x87, 0x11, 0x31,
+    0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01,
+    0x80, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x87, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10,
+    0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x04, 0x10, 0x01,
+    0x11, 0x10, 0x01, 0x84, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x87, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x83, 0x11, 0x03, 0x10, 0x01, 0x10, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0x0D, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x87, 0x11, 0x31, 0x10, 0x01, 0x11,
+    0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x81,
+    0x11, 0x05, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01,
+    0x10, 0x01, 0x81, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x10, 0x01, 0x87, 0x11, 0x0D, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x83, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11,
+    0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x10, 0x01, 0x84, 0x11,
+    0x01, 0x10, 0x01, 0x82, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x04, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x84, 0x11, 0x0C, 0x10, 0x01, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01,
+    0x87, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x83, 0x11, 0x03,
+    0x10, 0x01, 0x10, 0x01, 0x83, 0x11, 0x09, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x81, 0x11, 0x01, 0x10, 0x01, 0xFF, 0x11, 0x10, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00,
+    0x20, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x11, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11, 0x10, 0x80, 0x00, 0x08, 0x01, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01,
+    0x10, 0x01, 0x82, 0x11, 0x00, 0x10, 0x80, 0x00, 0x0B, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x0D, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11,
+    0x0A, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10,
+    0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01, 0x81, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11,
+    0x02, 0x10, 0x00, 0x01, 0x86, 0x11, 0x0E, 0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10,
+    0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x07, 0x01, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00, 0x03, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x06, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0xFF,
+    0x11, 0x80, 0x11, 0x0E, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10,
+    0x00, 0x00, 0x01, 0x85, 0x11, 0x00, 0x10, 0x80, 0x00, 0x20, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01,
+    0x11, 0x11, 0x10, 0x01, 0x10, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x02, 0x01, 0x11,
+    0x10, 0x80, 0x00, 0x08, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80, 0x00, 0x00,
+    0x01, 0x84, 0x11, 0x01, 0x10, 0x01, 0x80, 0x11, 0x01, 0x10, 0x01, 0x82, 0x11, 0x00, 0x10, 0x80,
+    0x00, 0x0B, 0x01, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85, 0x11,
+    0x00, 0x10, 0x80, 0x00, 0x0D, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x00, 0x00,
+    0x01, 0x11, 0x10, 0x80, 0x00, 0x00, 0x01, 0x84, 0x11, 0x0A, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01,
+    0x11, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x85, 0x11, 0x01, 0x10, 0x01,
+    0x81, 0x11, 0x03, 0x10, 0x00, 0x00, 0x01, 0x80, 0x11, 0x02, 0x10, 0x00, 0x01, 0x86, 0x11, 0x0E,
+    0x10, 0x00, 0x01, 0x11, 0x10, 0x01, 0x11, 0x11, 0x10, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x85,
+    0x11, 0x00, 0x10, 0x80, 0x00, 0x07, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0x11, 0x10, 0x80, 0x00,
+    0x03, 0x01, 0x11, 0x10, 0x01, 0x82, 0x11, 0x06, 0x10, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10, 0x80,
+    0x00, 0x05, 0x01, 0x11, 0x10, 0x00, 0x00, 0x01, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11,
+    0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x11, 0x8D, 0x11,
+};
+#define SCREEN_IMAGE_ERROR_SIZE 6572
+
+#endif // SCREEN_ASSETS_H
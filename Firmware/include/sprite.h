@@ -0,0 +1,28 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+
+// Sprites baked into flash by Server/utils/sprite_generator.py. Bitmaps are
+// packed 4bpp palette indices (see Canvas::blit) and already rotated into
+// panel orientation: a glyph that is `advance` pixels wide in the portrait
+// layout is `height` panel pixels wide and `advance` panel rows tall.
+struct SpriteGlyph {
+    uint8_t code;      // Latin-1 character
+    uint8_t advance;   // Portrait width in pixels
+    uint16_t offset;   // Start of the glyph in the font's bitmap array
+};
+
+struct SpriteFont {
+    uint8_t height;    // Line height in portrait pixels
+    uint8_t glyphCount;
+    const SpriteGlyph* glyphs;
+    const uint8_t* bitmaps;
+};
+
+struct WeatherIconSprite {
+    char code[4];      // OpenWeather icon code, e.g. "10d"
+    const uint8_t* bitmap;
+};
+
+#endif // SPRITE_H
@@ -0,0 +1,98 @@
+#ifndef TILE_ASSEMBLER_H
+#define TILE_ASSEMBLER_H
+
+#include "frame_sink.h"
+#include "frame_format.h"
+#include "frame_decoder.h"
+#include "tile_cache.h"
+#include "config.h"
+
+#define TILE_COLUMNS        (DISPLAY_WIDTH / TILE_SIZE)
+#define TILE_ROWS           (DISPLAY_HEIGHT / TILE_SIZE)
+#define TILE_COUNT          (TILE_COLUMNS * TILE_ROWS)
+#define TILE_INDEX_MAX_SIZE (TILE_INDEX_HEADER_SIZE + TILE_COUNT * TILE_INDEX_ENTRY_SIZE)
+
+static_assert(TILE_COLUMNS * TILE_SIZE == DISPLAY_WIDTH && TILE_ROWS * TILE_SIZE == DISPLAY_HEIGHT,
+              "Tiles must cover the display exactly");
+
+// Builds a frame in an arena slot from a tile index: tiles repeated in the
+// frame are copied, cached ones come from flash and the rest is downloaded
+// as byte ranges of the pack. Range bodies go in as a frame stream; each
+// tile container in them is decoded by the fetcher's FrameDecoder, checked
+// against its CRC and stored in the cache.
+class TileAssembler : public FrameSink {
+public:
+    TileAssembler();
+    
+    void setDecoder(FrameDecoder* tileDecoder) { decoder = tileDecoder; }
+    void setCache(TileCache* tileCache) { cache = tileCache; }
+    
+    // The fetcher reads the index file straight into this
+    uint8_t* getIndexBuffer() { return indexData; }
+    // Decoder output while ranges are streamed
+    FrameSink* getTileOutput() { return &writer; }
+    
+    // frame receives DISPLAY_FRAME_SIZE bytes
+    bool begin(uint8_t* frame, size_t indexSize);
+    // Next pack bytes to download, merging tiles a small gap apart
+    bool nextRange(uint32_t& start, uint32_t& end);
+    // Copies repeated tiles and checks the frame CRC
+    bool finish();
+    
+    // The body of the range from nextRange()
+    bool beginFrame(size_t rangeSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+
+private:
+    enum TileState : uint8_t {
+        TILE_MISSING,
+        TILE_DONE,
+        TILE_REPEAT  // Same pixels as an earlier tile, copied by finish()
+    };
+    
+    // Decoded bytes of one tile into the staging buffer
+    class TileWriter : public FrameSink {
+    public:
+        explicit TileWriter(TileAssembler* owner) : owner(owner), position(0), received(0), crc(0) {}
+        
+        void start(uint8_t tile) { position = tile; }
+        bool beginFrame(size_t frameSize) override;
+        bool writeFrame(const uint8_t* data, size_t length) override;
+        bool endFrame(bool commit) override;
+    
+    private:
+        TileAssembler* owner;
+        uint8_t position;
+        size_t received;
+        uint32_t crc;
+    };
+    
+    FrameDecoder* decoder;
+    TileCache* cache;
+    TileWriter writer;
+    uint8_t* frame;
+    
+    uint8_t indexData[TILE_INDEX_MAX_SIZE];
+    TileIndexHeader header;
+    const TileIndexEntry* entries;  // Into indexData
+    TileState state[TILE_COUNT];
+    uint8_t source[TILE_COUNT];     // Tile a repeat is copied from
+    
+    // Range being streamed: its tiles by offset and the pack offset reached
+    uint8_t rangeTiles[TILE_COUNT];
+    uint32_t rangeStart;
+    uint32_t rangeEnd;
+    int rangeCount;
+    int rangePos;
+    uint32_t streamPos;
+    bool tileOpen;
+    
+    uint8_t tile[TILE_BYTES];
+    
+    void blitTile(int position, const uint8_t* pixels);
+    void copyTile(int to, int from);
+    uint8_t* tileOrigin(int position) const;
+};
+
+#endif // TILE_ASSEMBLER_H
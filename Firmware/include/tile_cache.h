@@ -0,0 +1,58 @@
+#ifndef TILE_CACHE_H
+#define TILE_CACHE_H
+
+#include <FS.h>
+#include "frame_format.h"
+#include "config.h"
+
+#define TILE_CACHE_PACK_PATH   "/tiles.pak"
+#define TILE_CACHE_INDEX_PATH  "/tiles.idx"
+#define TILE_CACHE_INDEX_MAGIC 0x58444954  // "TIDX"
+
+// Decoded tiles on LittleFS, looked up by the CRC-32 of their pixels and
+// evicted least recently used. Tiles live in fixed slots of one pack file,
+// so a tile costs TILE_BYTES rather than a whole flash block. Every read
+// re-checks the CRC, which makes a slot torn by a reset just a miss; the
+// small index holding the CRCs and use counters is written once per frame
+// by flush(). Needs LittleFS mounted (FrameStore::begin()).
+class TileCache {
+public:
+    TileCache();
+    
+    bool begin();
+    
+    // tile receives TILE_BYTES
+    bool read(uint32_t crc, uint8_t* tile);
+    bool contains(uint32_t crc) const { return find(crc) >= 0; }
+    bool write(uint32_t crc, const uint8_t* tile);
+    bool flush();
+    
+    int getHits() const { return hits; }
+    int getMisses() const { return misses; }
+
+private:
+    struct Entry {
+        uint32_t crc;
+        uint32_t lastUse;  // 0 for an empty slot
+    };
+    
+    struct CacheIndex {
+        uint32_t magic;
+        uint32_t slots;
+        uint32_t useCounter;
+        Entry entries[TILE_CACHE_SLOTS];
+    };
+    
+    CacheIndex index;
+    bool ready;
+    bool dirty;
+    int hits;
+    int misses;
+    File pack;
+    
+    int find(uint32_t crc) const;
+    int pickSlot() const;
+    bool openPack();
+};
+
+#endif // TILE_CACHE_H
@@ -0,0 +1,56 @@
+#ifndef UPDATE_POLICY_H
+#define UPDATE_POLICY_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "weather_overlay.h"
+#include "rtc_state.h"
+
+enum BatteryLevel {
+    BATTERY_UNKNOWN = 0,  // No divider fitted, or no reading
+    BATTERY_NORMAL,
+    BATTERY_LOW,          // Small overlay changes wait for the next real one
+    BATTERY_CRITICAL      // ...for longer, and every update wake is spread out
+};
+
+#define POLICY_AVERAGE_SHIFT    2    // Link averages weigh each wake 1/4
+#define BATTERY_SAMPLES         8    // ADC readings averaged per wake
+
+// Picks how hard the next update cycles work from what the last ones
+// measured. A weak link (smoothed RSSI, or download throughput from the
+// metrics) skips generation slots and holds back firmware updates; the
+// fetcher already asks for the smallest transfer the server offers. A low
+// battery keeps clock-only overlay changes off the panel, whose refresh
+// dwarfs the update itself, and a critical one also skips slots.
+// Well-connected units on a good battery are left alone. Everything
+// measured is kept in RTC memory so it carries across wakes.
+class UpdatePolicy {
+public:
+    UpdatePolicy();
+    
+    // Reads the battery; call in setup() before the radio loads the supply
+    void begin();
+    // After the association (RSSI) and after the update (throughput)
+    void recordLink(int rssi);
+    void recordDownload();
+    
+    bool weakLink() const { return rtcState.policyWeakLink; }
+    BatteryLevel getBatteryLevel() const { return (BatteryLevel)rtcState.policyBattery; }
+    // Generation slots per update wake, 1 when nothing needs saving
+    uint32_t intervalScale() const;
+    // The panel keeps its overlay: only the clock moved, and not by much
+    bool deferOverlay(const WeatherData& weather, time_t now) const;
+    // Firmware images are large and an interrupted install wastes all of it
+    bool allowOta() const { return !weakLink() && getBatteryLevel() != BATTERY_CRITICAL; }
+    
+    const char* describe() const;
+    void toJson(JsonObject obj) const;
+
+private:
+    uint32_t downloadCountAtWake;  // Metric samples before this wake's update
+    
+    uint16_t readBatteryMv() const;
+    void updateLinkState();
+};
+
+#endif // UPDATE_POLICY_H
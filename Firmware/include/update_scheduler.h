@@ -0,0 +1,57 @@
+#ifndef UPDATE_SCHEDULER_H
+#define UPDATE_SCHEDULER_H
+
+#include <Arduino.h>
+#include "rtc_state.h"
+
+// Decides when the next update wake happens and puts the chip into deep
+// sleep until then. Successful updates wake just after the server's next
+// scheduled generation, as announced by the manifest or derived from the
+// cron period, plus a per-device offset derived from the MAC so a fleet
+// does not hit the origin in the same second. Failures retry quickly when
+// transient, honor Retry-After when rate limited and otherwise back off
+// exponentially with jitter. Playlists additionally wake once per dwell
+// to rotate the view from flash, counting down to the next update. All
+// state is kept in RTC memory so it survives the sleep.
+class UpdateScheduler {
+public:
+    UpdateScheduler();
+    
+    void begin();  // Call first thing in setup()
+    bool wokeFromTimer() const { return timerWake; }
+    
+    // Wall clock (needs WiFi); only resyncs when stale
+    bool syncClock();
+    bool hasValidClock() const;
+    
+    // Spreads the first fetch of devices that all powered up together
+    void staggerColdStart() const;
+    
+    void recordSuccess();
+    // httpCode: last HTTP status (negative for transport errors, 0 if no
+    // request was made); retryAfterS: the server's Retry-After, 0 if none
+    void recordFailure(int httpCode = 0, uint32_t retryAfterS = 0);
+    uint32_t getConsecutiveFailures() const { return rtcState.consecutiveFailures; }
+    
+    // Playlist dwell in seconds, 0 for a single view
+    void setDwell(uint32_t seconds) { dwellSeconds = seconds; }
+    // Successful updates wake every scale-th generation slot (UpdatePolicy)
+    void setIntervalScale(uint32_t scale) { intervalScale = max(scale, (uint32_t)1); }
+    // False on rotation-only wakes, which need no network
+    bool refreshDue() const { return !timerWake || rtcState.refreshCountdownS == 0; }
+    // The panel has shown the current view for a full dwell
+    bool rotationDue() const { return timerWake && rtcState.rotationPending; }
+    
+    uint32_t secondsUntilNextUpdate() const;
+    void sleepUntilNextUpdate();  // Does not return
+    
+private:
+    bool timerWake;
+    uint32_t dwellSeconds;
+    uint32_t intervalScale;
+    uint32_t deviceSeed;  // Fixed per device - the same offsets every wake
+    
+    uint32_t jitter(uint32_t range, uint32_t salt) const;
+};
+
+#endif // UPDATE_SCHEDULER_H
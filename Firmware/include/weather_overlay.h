@@ -0,0 +1,65 @@
+#ifndef WEATHER_OVERLAY_H
+#define WEATHER_OVERLAY_H
+
+#include <time.h>
+#include "frame_sink.h"
+#include "canvas.h"
+#include "sprite.h"
+#include "config.h"
+
+// Panel rectangle the device draws into - the blank band the server leaves
+// in the base frame (portrait 82,694 316x72, DEVICE_OVERLAY_BAND in
+// Server/config/settings.py). x and width are even so rows are whole bytes.
+#define OVERLAY_BAND_X          34
+#define OVERLAY_BAND_Y          82
+#define OVERLAY_BAND_WIDTH      72
+#define OVERLAY_BAND_HEIGHT     316
+#define OVERLAY_BAND_ROW_BYTES  (OVERLAY_BAND_WIDTH / 2)
+#define OVERLAY_GROUP_SPACING   15   // Between date/time, icon and temperature
+
+// Contents of <name>.weather.json
+struct WeatherData {
+    uint32_t baseCrc;        // Base frame the overlay belongs on
+    uint32_t nextUpdate;     // Epoch of the next scheduled generation
+    int32_t utcOffset;       // Seconds, for the on-device clock
+    bool hasWeather;
+    int temperature;         // Degrees Celsius
+    char icon[4];            // OpenWeather icon code
+};
+
+// Draws date, time and weather over the base map while it streams to the
+// panel. The band is rendered once into a small buffer; every frame passing
+// through has the bytes inside the band replaced, everything else is
+// forwarded untouched, so the frame store keeps the clean base.
+class WeatherOverlay : public FrameSink {
+public:
+    WeatherOverlay();
+    
+    void setOutput(FrameSink* sink) { output = sink; }
+    
+    // now = 0 leaves the clock out; returns the CRC of the rendered band
+    uint32_t render(const WeatherData& data, time_t now);
+    uint32_t getCrc() const { return bandCrc; }
+    
+    bool beginFrame(size_t frameSize) override;
+    bool writeFrame(const uint8_t* data, size_t length) override;
+    bool endFrame(bool commit) override;
+    
+private:
+    FrameSink* output;
+    size_t offset;
+    uint32_t bandCrc;
+    WeatherData rendered;  // What the band shows, recorded once it is on the panel
+    time_t renderedAt;
+    uint8_t band[OVERLAY_BAND_ROW_BYTES * OVERLAY_BAND_HEIGHT];
+    
+    size_t nextBandOffset() const;
+    
+    // Portrait layout: u runs along the band, v across it
+    static const SpriteGlyph* findGlyph(const SpriteFont& font, uint8_t code);
+    static int textWidth(const SpriteFont& font, const char* text);
+    static void drawText(Canvas& canvas, const SpriteFont& font, const char* text, int u, int v);
+    static void drawSprite(Canvas& canvas, const uint8_t* sprite, int u, int v, int width, int height);
+};
+
+#endif // WEATHER_OVERLAY_H
@@ -0,0 +1,127 @@
+// Generated by scripts/embed_web_assets.py from web/ - do not edit
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+// index.html: 2318 bytes, 958 gzipped
+static const uint8_t WEB_INDEX_HTML[] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x56, 0x6D, 0x6F, 0xDB, 0x36,
+    0x10, 0xFE, 0xEE, 0x5F, 0x71, 0x63, 0x51, 0x60, 0x03, 0xA2, 0x58, 0x8E, 0x13, 0xC4, 0xF0, 0x1B,
+    0x50, 0x34, 0xE9, 0xB6, 0x0F, 0x5D, 0x8D, 0x39, 0xC5, 0x30, 0x0C, 0x43, 0x40, 0x89, 0x94, 0x44,
+    0x84, 0x22, 0x35, 0x92, 0xF2, 0x4B, 0x87, 0xFC, 0xF7, 0x1D, 0x29, 0xD9, 0x96, 0xDC, 0x14, 0x5B,
+    0x06, 0x7F, 0xA0, 0x79, 0x3C, 0xDE, 0x3D, 0xCF, 0xBD, 0x51, 0xF3, 0xEF, 0xEE, 0x3E, 0xBD, 0x7F,
+    0xF8, 0x7D, 0x75, 0x0F, 0x85, 0x2B, 0xE5, 0x72, 0x30, 0x3F, 0x2C, 0x9C, 0x32, 0x5C, 0x4A, 0xEE,
+    0x28, 0xA4, 0x05, 0x35, 0x96, 0xBB, 0x05, 0xF9, 0xFC, 0xF0, 0x21, 0x9A, 0x90, 0x83, 0x58, 0xD1,
+    0x92, 0x2F, 0xC8, 0x46, 0xF0, 0x6D, 0xA5, 0x8D, 0x23, 0x90, 0x6A, 0xE5, 0xB8, 0x42, 0xB5, 0xAD,
+    0x60, 0xAE, 0x58, 0x30, 0xBE, 0x11, 0x29, 0x8F, 0xC2, 0xE6, 0x02, 0x84, 0x12, 0x4E, 0x50, 0x19,
+    0xD9, 0x94, 0x4A, 0xBE, 0x18, 0x5D, 0xC6, 0xDE, 0x8C, 0x13, 0x4E, 0xF2, 0xE5, 0xBA, 0xA4, 0xC6,
+    0xC1, 0x1D, 0xB5, 0x45, 0xA2, 0xA9, 0x61, 0xF0, 0x5E, 0xAB, 0x4C, 0xE4, 0xB5, 0xA1, 0x4E, 0x68,
+    0x35, 0x1F, 0x36, 0x4A, 0x83, 0xB9, 0x75, 0x7B, 0xBF, 0x26, 0x9A, 0xED, 0xE1, 0x6F, 0xC8, 0xD0,
+    0x59, 0x94, 0xD1, 0x52, 0xC8, 0xFD, 0x14, 0xDE, 0x19, 0x34, 0x7D, 0x01, 0x96, 0x2A, 0x1B, 0x59,
+    0x6E, 0x44, 0x36, 0x03, 0xB4, 0x99, 0x0B, 0x35, 0x85, 0xAB, 0xB8, 0xDA, 0xCD, 0x20, 0xA1, 0xE9,
+    0x53, 0x6E, 0x74, 0xAD, 0xD8, 0x14, 0xDE, 0x64, 0xB1, 0xFF, 0xCD, 0xE0, 0x79, 0x70, 0xE9, 0x21,
+    0x53, 0xA1, 0xB8, 0x41, 0x8B, 0x25, 0xDD, 0x35, 0x60, 0xA7, 0x70, 0x13, 0x87, 0x5B, 0x07, 0x1B,
+    0x31, 0xD0, 0xDA, 0xE9, 0xBE, 0x95, 0x6D, 0x21, 0x1C, 0x9F, 0x41, 0x45, 0x19, 0x13, 0x2A, 0x3F,
+    0xFA, 0xD1, 0x86, 0x71, 0x13, 0x19, 0xCA, 0x44, 0x6D, 0xA7, 0x30, 0x0A, 0xC2, 0xE7, 0x41, 0x31,
+    0x42, 0xFB, 0xA9, 0x96, 0xDA, 0xA0, 0xFB, 0xF1, 0x78, 0x3C, 0x03, 0xC7, 0x77, 0x2E, 0xA2, 0x52,
+    0xE4, 0x68, 0x3E, 0xC5, 0xA0, 0x71, 0x13, 0xF0, 0x64, 0xDA, 0x94, 0x91, 0x77, 0x51, 0x05, 0x40,
+    0xDE, 0x7D, 0x94, 0x68, 0xE7, 0x74, 0x89, 0xC6, 0x6E, 0x1A, 0x63, 0x92, 0x26, 0x5C, 0xE2, 0x31,
+    0x13, 0xB6, 0x92, 0x14, 0xD9, 0x27, 0x52, 0xA7, 0x4F, 0xB3, 0x73, 0xF5, 0xA0, 0x1D, 0xA2, 0xB4,
+    0xE5, 0x22, 0x2F, 0x1C, 0xEA, 0x69, 0xC9, 0xBC, 0x01, 0xA1, 0xAA, 0xDA, 0xFD, 0xE1, 0xF6, 0x15,
+    0x66, 0xCF, 0xE3, 0x20, 0x7F, 0xFA, 0xF4, 0x9C, 0x64, 0x15, 0xB5, 0x76, 0x8B, 0x44, 0xCE, 0xE5,
+    0xAA, 0x2E, 0x13, 0x6E, 0xBC, 0xD4, 0xDF, 0xA2, 0x86, 0x53, 0x44, 0xD1, 0x46, 0x6C, 0x14, 0xC7,
+    0x6F, 0x3B, 0xD1, 0x98, 0x9C, 0x82, 0x81, 0x67, 0xD5, 0x0E, 0xAC, 0x96, 0x82, 0xC1, 0x1B, 0xC6,
+    0xD8, 0x57, 0x41, 0xBA, 0x6E, 0x74, 0x77, 0x91, 0x15, 0x5F, 0xC2, 0xE5, 0xF6, 0x1C, 0x45, 0x1E,
+    0x6D, 0x52, 0x23, 0x1F, 0x85, 0x9E, 0x7A, 0x39, 0x8C, 0xE3, 0xDB, 0x34, 0xA1, 0xB3, 0x43, 0x50,
+    0xCF, 0xB3, 0xE1, 0x03, 0xDF, 0x4B, 0xC9, 0x14, 0x94, 0x56, 0xFC, 0x65, 0xDF, 0x69, 0x6D, 0xAC,
+    0x37, 0x52, 0x69, 0xD1, 0x24, 0xA2, 0xC7, 0xE9, 0x80, 0x60, 0x5A, 0xE8, 0x4D, 0xA8, 0x93, 0x33,
+    0x1C, 0x37, 0x74, 0x72, 0x1B, 0x72, 0x27, 0x54, 0xA6, 0xCF, 0x8F, 0xF9, 0x6D, 0x36, 0xCE, 0xB2,
+    0x33, 0x60, 0x2F, 0xA3, 0x68, 0xD3, 0xE7, 0x74, 0x75, 0x28, 0xA6, 0xE7, 0xC1, 0x7C, 0xD8, 0x16,
+    0xFD, 0x7C, 0xD8, 0xF6, 0xA3, 0xAF, 0x7E, 0x5C, 0x98, 0xD8, 0x40, 0x2A, 0x31, 0x4F, 0x0B, 0x72,
+    0x2C, 0x61, 0xDF, 0x50, 0xC5, 0xE8, 0xAB, 0x6E, 0x5A, 0x73, 0x57, 0x57, 0x78, 0x7F, 0x84, 0xC7,
+    0xBE, 0xBC, 0x80, 0xA6, 0xBE, 0xAF, 0x16, 0x64, 0x98, 0x86, 0x3E, 0x23, 0x80, 0xCD, 0x5C, 0x68,
+    0xB6, 0x20, 0xAB, 0x4F, 0xEB, 0x07, 0xD2, 0x37, 0x7E, 0xAA, 0x47, 0x7F, 0xD0, 0x54, 0x1E, 0xCA,
+    0x7C, 0x8B, 0x67, 0xE2, 0xD1, 0x5A, 0xC1, 0xC8, 0xF2, 0x37, 0xF1, 0x41, 0xC0, 0x2F, 0xDC, 0x61,
+    0xC9, 0x3C, 0x4D, 0xE7, 0xC3, 0xA0, 0x84, 0xCA, 0xA1, 0x72, 0xA0, 0x53, 0x65, 0x20, 0x58, 0xF7,
+    0x5E, 0x3B, 0x3E, 0x3A, 0x02, 0xC3, 0xFF, 0xAA, 0x85, 0xE1, 0x9E, 0xE6, 0x10, 0x31, 0xBC, 0x06,
+    0xC9, 0xB1, 0x64, 0x1B, 0x34, 0xAB, 0x76, 0xFB, 0x0D, 0x38, 0x47, 0xED, 0x13, 0xA4, 0x93, 0xA8,
+    0x03, 0xEB, 0x64, 0xF5, 0x55, 0x88, 0x72, 0xE1, 0x8A, 0x3A, 0x79, 0x34, 0xBC, 0xD2, 0x64, 0xF9,
+    0xA3, 0x70, 0x3F, 0xD5, 0x09, 0xFC, 0x8A, 0x1B, 0x2B, 0x9C, 0x36, 0xFB, 0x7F, 0x0D, 0x51, 0xF7,
+    0x7A, 0x8B, 0xA6, 0x27, 0x3A, 0x84, 0x09, 0xB0, 0xFB, 0x53, 0x5E, 0x60, 0x53, 0x73, 0x74, 0xAA,
+    0xB7, 0x58, 0x02, 0x43, 0x73, 0x74, 0xF3, 0xFF, 0x30, 0x57, 0xD4, 0x15, 0x64, 0xF9, 0x73, 0x49,
+    0x73, 0x8E, 0x41, 0xC4, 0x26, 0xF8, 0x8F, 0x60, 0xC3, 0xBD, 0x3E, 0xD8, 0x46, 0xF4, 0x32, 0x58,
+    0x76, 0xA8, 0xCE, 0xC7, 0xEB, 0x49, 0xBC, 0x9B, 0xC4, 0xF1, 0x65, 0xA5, 0xF2, 0x57, 0x22, 0xF6,
+    0xB3, 0x4F, 0x0A, 0xEB, 0xC8, 0xF2, 0xA3, 0x36, 0x1C, 0x02, 0x66, 0x0B, 0xDF, 0xEB, 0xCA, 0x57,
+    0xB7, 0x7F, 0x0D, 0xB0, 0xDF, 0xC1, 0x83, 0x80, 0x0A, 0xDB, 0x56, 0x62, 0x87, 0x5C, 0x00, 0x8E,
+    0x55, 0xA7, 0x61, 0xFC, 0x43, 0x87, 0xD6, 0x71, 0x94, 0x79, 0x36, 0x47, 0x9B, 0x2D, 0x95, 0xD3,
+    0xDE, 0xE8, 0x2D, 0x82, 0x19, 0x93, 0x3E, 0x0F, 0xFF, 0x96, 0x29, 0x46, 0x4D, 0x9F, 0x06, 0x3E,
+    0x59, 0xAD, 0xD1, 0xD7, 0x31, 0x62, 0x5B, 0x2E, 0xE5, 0x63, 0x29, 0x54, 0xED, 0xB8, 0x45, 0x5A,
+    0xCD, 0x1F, 0x58, 0x21, 0xFC, 0xC0, 0xEE, 0x1B, 0xC9, 0x68, 0xC7, 0x72, 0x20, 0xD0, 0x37, 0xD1,
+    0xB2, 0x38, 0x13, 0xE2, 0x9F, 0x05, 0x19, 0x11, 0xFF, 0xDE, 0xE1, 0x7A, 0x7D, 0x1D, 0x13, 0xD8,
+    0x50, 0x59, 0xA3, 0xE2, 0x28, 0xEE, 0xE4, 0xA0, 0x9D, 0xBB, 0x8D, 0x0F, 0x5B, 0x27, 0xA5, 0xC0,
+    0x50, 0xAF, 0xE9, 0x86, 0x9F, 0xBF, 0xCF, 0x8D, 0xA2, 0xBF, 0xE8, 0x99, 0xF5, 0xB9, 0xFA, 0x99,
+    0x48, 0xC2, 0xDB, 0x6D, 0xB4, 0xCA, 0x97, 0x77, 0xE1, 0x93, 0x60, 0xEA, 0xC7, 0x5A, 0xD8, 0xC3,
+    0xFD, 0x7A, 0x35, 0xBE, 0x8A, 0xD6, 0x57, 0x70, 0x36, 0xB5, 0xE6, 0x89, 0xE9, 0xDC, 0x6A, 0x1F,
+    0xBA, 0xD3, 0xB5, 0xDB, 0x4B, 0xCC, 0xC4, 0x7D, 0xB4, 0xA2, 0x98, 0xDA, 0x9E, 0xEA, 0xE7, 0x8A,
+    0x51, 0xD7, 0x73, 0x80, 0x33, 0x7B, 0x8F, 0x53, 0x17, 0x5A, 0xFA, 0x47, 0x7A, 0x87, 0xA5, 0x1D,
+    0xA8, 0xC3, 0xE6, 0xB3, 0xE7, 0x1F, 0x3C, 0xCB, 0xE0, 0x4C, 0x0E, 0x09, 0x00, 0x00,
+};
+#define WEB_INDEX_HTML_SIZE 958
+#define WEB_INDEX_HTML_TYPE "text/html"
+
+// success.html: 1430 bytes, 764 gzipped
+static const uint8_t WEB_SUCCESS_HTML[] PROGMEM = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x54, 0x5D, 0x8B, 0xDB, 0x48,
+    0x10, 0x7C, 0xF7, 0xAF, 0xE8, 0xF8, 0x1E, 0x36, 0x81, 0x95, 0x65, 0xAF, 0x2F, 0x24, 0xD8, 0xB2,
+    0x8F, 0x23, 0x7B, 0x7B, 0x09, 0x5C, 0x48, 0xC8, 0x3A, 0x84, 0x3C, 0xB6, 0x35, 0x2D, 0x6B, 0xC8,
+    0x68, 0x46, 0xCC, 0xB4, 0xEC, 0x15, 0x61, 0xFF, 0xFB, 0xF5, 0xE8, 0x23, 0x6B, 0xC3, 0x06, 0x83,
+    0x07, 0x4B, 0xD3, 0xD5, 0x55, 0x5D, 0xD5, 0xCE, 0x5E, 0xDC, 0x7E, 0x7A, 0xB7, 0xFB, 0xFE, 0xF9,
+    0x1F, 0x28, 0xB9, 0x32, 0xDB, 0x49, 0x36, 0x1E, 0x84, 0x4A, 0x8E, 0x8A, 0x18, 0x21, 0x2F, 0xD1,
+    0x07, 0xE2, 0xCD, 0xF4, 0xEB, 0xEE, 0x2E, 0x79, 0x3B, 0x1D, 0x1F, 0x5B, 0xAC, 0x68, 0x33, 0x3D,
+    0x6A, 0x3A, 0xD5, 0xCE, 0xF3, 0x14, 0x72, 0x67, 0x99, 0xAC, 0x5C, 0x3B, 0x69, 0xC5, 0xE5, 0x46,
+    0xD1, 0x51, 0xE7, 0x94, 0x74, 0x3F, 0xAE, 0x41, 0x5B, 0xCD, 0x1A, 0x4D, 0x12, 0x72, 0x34, 0xB4,
+    0x59, 0xCC, 0xE6, 0x11, 0x86, 0x35, 0x1B, 0xDA, 0xBE, 0x73, 0xB6, 0xD0, 0x87, 0xC6, 0x23, 0x6B,
+    0x67, 0xE1, 0x1E, 0x8F, 0xA4, 0xB2, 0xB4, 0x7F, 0x35, 0xC9, 0x02, 0xB7, 0xF1, 0xDC, 0x3B, 0xD5,
+    0xC2, 0x4F, 0x28, 0xA4, 0x45, 0x52, 0x60, 0xA5, 0x4D, 0xBB, 0x82, 0xBF, 0xBD, 0x00, 0x5E, 0x43,
+    0x40, 0x1B, 0x92, 0x40, 0x5E, 0x17, 0x6B, 0xA8, 0xD0, 0x1F, 0xB4, 0x5D, 0xC1, 0xCD, 0xBC, 0x7E,
+    0x58, 0xC3, 0x1E, 0xF3, 0x1F, 0x07, 0xEF, 0x1A, 0xAB, 0x56, 0xF0, 0x47, 0x31, 0x8F, 0x9F, 0x35,
+    0x3C, 0x4E, 0x66, 0x91, 0x28, 0x6A, 0x4B, 0x5E, 0x10, 0x2B, 0x7C, 0xE8, 0x29, 0xAE, 0xE0, 0xF5,
+    0xBC, 0xAB, 0x1A, 0x31, 0xE6, 0x80, 0x0D, 0xBB, 0x4B, 0x94, 0x53, 0xA9, 0x99, 0xD6, 0x50, 0xA3,
+    0x52, 0xDA, 0x1E, 0x7E, 0xF5, 0x71, 0x5E, 0x91, 0x4F, 0x3C, 0x2A, 0xDD, 0x84, 0x15, 0x2C, 0xBA,
+    0x87, 0x8F, 0x93, 0x72, 0x21, 0xF8, 0xB9, 0x33, 0xCE, 0x4B, 0xFB, 0xE5, 0x72, 0xB9, 0x06, 0xA6,
+    0x07, 0x4E, 0xD0, 0xE8, 0x83, 0xC0, 0xE7, 0x32, 0x2A, 0xF2, 0x1D, 0x1F, 0x6D, 0x0B, 0x27, 0x57,
+    0x2F, 0xE8, 0xD2, 0x9B, 0x62, 0x59, 0x14, 0x67, 0xAD, 0x16, 0xCF, 0xB5, 0xFA, 0xF3, 0x89, 0x70,
+    0xC2, 0xAE, 0x1E, 0x09, 0x3D, 0x4E, 0xB2, 0x74, 0x18, 0x5C, 0x96, 0x0E, 0x4E, 0xC6, 0x09, 0xCA,
+    0xA1, 0xF4, 0x11, 0x72, 0x83, 0x21, 0x6C, 0xA6, 0xBF, 0xC6, 0x10, 0xAD, 0x28, 0x17, 0xCF, 0xF9,
+    0x00, 0xF7, 0x4D, 0x9E, 0x53, 0x08, 0x45, 0x63, 0x4C, 0xFB, 0x42, 0xB0, 0x16, 0x97, 0x10, 0xA1,
+    0x7F, 0x9D, 0x54, 0xF2, 0x85, 0x07, 0x8A, 0x40, 0xF5, 0xF6, 0xBB, 0x6B, 0x3C, 0xDC, 0x0B, 0x2B,
+    0x86, 0x5B, 0x0C, 0xE5, 0xDE, 0xA1, 0x57, 0x50, 0x62, 0x80, 0x3D, 0x91, 0x8D, 0x29, 0xE9, 0xBA,
+    0x08, 0x38, 0x5A, 0x05, 0x27, 0x6D, 0x0C, 0x78, 0x0A, 0x1C, 0xAF, 0x87, 0x52, 0x82, 0x64, 0xDA,
+    0x59, 0x96, 0xD6, 0x1D, 0xD2, 0xAE, 0x24, 0xE8, 0x63, 0xD4, 0xDF, 0xB3, 0xEE, 0x14, 0xEB, 0x2D,
+    0xE5, 0x0C, 0xEC, 0xA0, 0x8D, 0x8D, 0xBE, 0xE9, 0x3B, 0x0D, 0x96, 0xF8, 0xE4, 0xFC, 0x8F, 0x0E,
+    0xB1, 0x87, 0x2A, 0x88, 0xF3, 0x52, 0x06, 0x07, 0xBA, 0x12, 0x62, 0x01, 0x0A, 0xEF, 0x2A, 0xF8,
+    0x57, 0xF3, 0xFB, 0x66, 0x3F, 0xC0, 0xA7, 0xA2, 0xE3, 0x52, 0x4D, 0xF4, 0x41, 0x92, 0x94, 0x47,
+    0xFD, 0xDD, 0x4C, 0x6E, 0xB6, 0xDF, 0x4A, 0x64, 0xE1, 0x5E, 0xD7, 0x64, 0x83, 0x74, 0x79, 0xE0,
+    0xBF, 0x64, 0x08, 0x37, 0xF2, 0xAE, 0x89, 0x4B, 0x62, 0xF4, 0xF6, 0xF6, 0x8C, 0xDE, 0x28, 0x23,
+    0xB2, 0x78, 0x8E, 0x66, 0x96, 0x4A, 0x41, 0x57, 0x75, 0xA7, 0x7D, 0xE0, 0x9E, 0x5A, 0x5F, 0xBA,
+    0x17, 0xA1, 0xEE, 0x64, 0x8D, 0x43, 0x35, 0x0C, 0x46, 0xE9, 0x50, 0x1B, 0x6C, 0xE3, 0x2E, 0x8C,
+    0x55, 0x1F, 0x7A, 0x29, 0x5D, 0x41, 0x53, 0x2B, 0x64, 0xEA, 0x22, 0x5A, 0x89, 0x61, 0xB2, 0x55,
+    0xA6, 0x05, 0x3A, 0x92, 0x6F, 0x25, 0x29, 0x50, 0x69, 0xDB, 0x30, 0x85, 0xA7, 0xD2, 0x38, 0xC9,
+    0xFC, 0xC2, 0xDF, 0xB8, 0xB3, 0x68, 0xC6, 0xB9, 0x82, 0x71, 0xF6, 0x20, 0x0B, 0x21, 0x3C, 0xF0,
+    0x88, 0xDA, 0xE0, 0xDE, 0xD0, 0x50, 0x9D, 0x76, 0x52, 0x87, 0x69, 0xD5, 0xE3, 0xAC, 0xAC, 0x63,
+    0xB1, 0xFB, 0x43, 0x01, 0xFC, 0xE4, 0x91, 0x72, 0x14, 0xEC, 0x15, 0x9F, 0x6B, 0x8F, 0xB2, 0x65,
+    0xF9, 0x79, 0x1C, 0x10, 0x37, 0xDE, 0xC6, 0xE7, 0x97, 0x5C, 0x2A, 0xA7, 0xA4, 0x6F, 0x21, 0xFB,
+    0x00, 0x28, 0xCE, 0x9D, 0x46, 0xFE, 0x97, 0x4E, 0x85, 0xDC, 0xEB, 0x9A, 0xB7, 0x13, 0xF9, 0x2B,
+    0xDA, 0xE9, 0x8A, 0x5C, 0xC3, 0x2F, 0x8B, 0xC6, 0x76, 0x6E, 0xBD, 0x7C, 0x05, 0x3F, 0x27, 0xCA,
+    0xE5, 0x4D, 0x25, 0x5B, 0x35, 0x8B, 0x51, 0x97, 0xA5, 0x92, 0x64, 0xBF, 0xDF, 0x7D, 0xFC, 0x0F,
+    0x36, 0x70, 0xF5, 0x9B, 0xD8, 0xC7, 0xD4, 0x0F, 0x06, 0x7E, 0xE9, 0xBD, 0x93, 0xC4, 0xCC, 0x66,
+    0xB3, 0x2E, 0xE8, 0x92, 0xBF, 0xCF, 0x86, 0x30, 0x88, 0x43, 0x18, 0x05, 0x94, 0xDA, 0xD0, 0xB9,
+    0xDA, 0xC1, 0xED, 0x70, 0x6E, 0x77, 0x78, 0x36, 0x96, 0x9D, 0x8C, 0x5E, 0xC5, 0xD5, 0x7A, 0xF2,
+    0x78, 0x0D, 0xCB, 0xF9, 0x7C, 0xFE, 0x6A, 0x1D, 0x97, 0x74, 0x90, 0x94, 0xA5, 0xC3, 0x7A, 0xA6,
+    0xFD, 0xDF, 0xEF, 0xFF, 0x03, 0x40, 0x88, 0xE8, 0x96, 0x05, 0x00, 0x00,
+};
+#define WEB_SUCCESS_HTML_SIZE 764
+#define WEB_SUCCESS_HTML_TYPE "text/html"
+
+#endif // WEB_ASSETS_H
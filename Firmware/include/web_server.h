@@ -6,25 +6,29 @@
 #include <DNSServer.h>
 #include <ArduinoJson.h>
 #include "config_manager.h"
+#include "update_policy.h"
 
 class WebConfigServer {
 private:
     WebServer server;
     DNSServer dnsServer;
     ConfigManager* configManager;
+    const UpdatePolicy* updatePolicy;
     bool serverStarted;
     
-    // HTML pages
-    String getIndexPage();
-    String getSuccessPage();
+    // Pages are gzipped at build time into web_assets.h
+    void sendAsset(const uint8_t* data, size_t size, const char* contentType);
     
     // Request handlers
     void handleRoot();
     void handleConfig();
     void handleStatus();
+    void handleRedirect();   // Captive-portal probes and unknown URLs
+    void handleNoContent();
     
 public:
     WebConfigServer(ConfigManager* configMgr);
+    void setUpdatePolicy(const UpdatePolicy* policy) { updatePolicy = policy; }  // Reported on /status
     bool startConfigAP();
     void stopServer();
     bool isServerStarted() const { return serverStarted; }
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+Status Screen Baker for the ESP32-S2 Smart Dashboard firmware.
+
+Renders the fixed status screens (configuration mode, WiFi failure, errors)
+with the firmware's 5x7 font and writes them as RLE frame containers into
+include/screen_assets.h. The firmware streams them from flash through its
+frame decoder straight into the panel, so showing one needs no frame
+buffer. The WiFi QR code is painted in while the screen streams.
+
+Runs automatically before every PlatformIO build (extra_scripts in
+platformio.ini) and only rewrites the header when its content changes.
+
+Usage (from the Firmware directory):
+    python scripts/bake_screens.py
+"""
+
+import os
+import re
+import struct
+import zlib
+
+DISPLAY_WIDTH = 800                  # DISPLAY_WIDTH in include/config.h
+DISPLAY_HEIGHT = 480
+BLACK = 0x0                          # EPD_7IN3F_* in include/epd7in3f.h
+WHITE = 0x1
+RED = 0x4
+
+# Frame container (include/frame_format.h), RLE so no inflater is needed
+FRAME_MAGIC = b'EPDF'
+FRAME_VERSION = 1
+CODEC_RLE = 1
+HEADER_FORMAT = '<4sBBBBHHIII'
+RLE_MIN_RUN = 3
+RLE_MAX_RUN = 0x7F + RLE_MIN_RUN
+RLE_MAX_LITERAL = 0x80
+
+SETUP_STEPS = [
+    ("1. Scan QR code to connect to WiFi", 386, 2, BLACK),
+    ("2. Open browser to 192.168.4.1", 414, 2, BLACK),
+    ("3. Configure your settings", 442, 2, BLACK),
+]
+
+# (C symbol, [(text, y, scale, color)]); the QR code of the setup screens
+# goes between the title and the steps (CONFIG_QR_* in display_handler.h)
+SCREENS = [
+    ('SCREEN_CONFIG', [("Smart Dashboard Setup", 30, 3, BLACK)] + SETUP_STEPS),
+    ('SCREEN_WIFI_FAILED', [("WiFi Connection Failed", 30, 3, RED)] + SETUP_STEPS),
+    ('SCREEN_SERVER_FAILED', [
+        ("Config Server Failed", 206, 3, RED),
+        ("Restart the device to try again", 250, 2, BLACK),
+    ]),
+    ('SCREEN_IMAGE_ERROR', [
+        ("Image Error", 206, 3, RED),
+        ("The downloaded frame does not fit the display", 250, 2, BLACK),
+    ]),
+]
+
+
+def load_font(firmware_dir: str) -> dict:
+    """Glyph columns from include/font5x7.h, keyed by character."""
+    with open(os.path.join(firmware_dir, 'include', 'font5x7.h'), encoding='utf-8') as f:
+        rows = re.findall(r'^\s*\{((?:\s*0x[0-9A-Fa-f]{2},?){5})\s*\}', f.read(), re.MULTILINE)
+    return {chr(0x20 + i): [int(v, 16) for v in row.replace(',', ' ').split()] for i, row in enumerate(rows)}
+
+
+class Screen:
+    """Packed 4bpp frame drawn like Canvas (include/canvas.h)"""
+
+    ADVANCE = 6  # FONT5X7_ADVANCE
+
+    def __init__(self, font: dict):
+        self.font = font
+        self.pixels = bytearray([WHITE]) * (DISPLAY_WIDTH * DISPLAY_HEIGHT)
+
+    def fill_rect(self, x: int, y: int, w: int, h: int, color: int):
+        for row in range(max(y, 0), min(y + h, DISPLAY_HEIGHT)):
+            start = row * DISPLAY_WIDTH
+            x0, x1 = max(x, 0), min(x + w, DISPLAY_WIDTH)
+            if x1 > x0:
+                self.pixels[start + x0:start + x1] = bytes([color]) * (x1 - x0)
+
+    def draw_text_centered(self, text: str, y: int, scale: int, color: int):
+        width = (len(text) * self.ADVANCE - 1) * scale if text else 0
+        x = (DISPLAY_WIDTH - width) // 2
+        for c in text:
+            if c != ' ':
+                for col, bits in enumerate(self.font.get(c, self.font['?'])):
+                    for row in range(7):
+                        if bits >> row & 1:
+                            self.fill_rect(x + col * scale, y + row * scale, scale, scale, color)
+            x += self.ADVANCE * scale
+
+    def pack(self) -> bytes:
+        # Left pixel in the high nibble
+        p = self.pixels
+        return bytes(p[i] << 4 | p[i + 1] for i in range(0, len(p), 2))
+
+
+def rle_encode(data: bytes) -> bytes:
+    """The container's run-length scheme (FrameCodec.rle_encode on the server)."""
+    out = bytearray()
+    literal_start = 0
+    i = 0
+
+    def flush_literals(end):
+        start = literal_start
+        while start < end:
+            chunk = min(RLE_MAX_LITERAL, end - start)
+            out.append(chunk - 1)
+            out.extend(data[start:start + chunk])
+            start += chunk
+
+    while i < len(data):
+        run_end = i + 1
+        while run_end < len(data) and data[run_end] == data[i] and run_end - i < RLE_MAX_RUN:
+            run_end += 1
+        if run_end - i >= RLE_MIN_RUN:
+            flush_literals(i)
+            out.append(0x80 | (run_end - i - RLE_MIN_RUN))
+            out.append(data[i])
+            i = run_end
+            literal_start = i
+        else:
+            i = run_end
+
+    flush_literals(len(data))
+    return bytes(out)
+
+
+def encode_container(raw: bytes) -> bytes:
+    payload = rle_encode(raw)
+    header = struct.pack(HEADER_FORMAT, FRAME_MAGIC, FRAME_VERSION, CODEC_RLE, 0, 0,
+                         DISPLAY_WIDTH, DISPLAY_HEIGHT, len(raw), len(payload),
+                         zlib.crc32(raw) & 0xFFFFFFFF)
+    return header + payload
+
+
+def c_bytes(data: bytes, indent: str = '    ') -> str:
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def generate_header(firmware_dir: str) -> str:
+    output_path = os.path.join(firmware_dir, 'include', 'screen_assets.h')
+    font = load_font(firmware_dir)
+    out = [
+        '// Generated by scripts/bake_screens.py - do not edit',
+        '#ifndef SCREEN_ASSETS_H',
+        '#define SCREEN_ASSETS_H',
+        '',
+        '#include <Arduino.h>',
+        '',
+    ]
+
+    for symbol, lines in SCREENS:
+        screen = Screen(font)
+        for text, y, scale, color in lines:
+            screen.draw_text_centered(text, y, scale, color)
+        container = encode_container(screen.pack())
+
+        out.append(f'// {lines[0][0]}: {len(container)} bytes')
+        out.append(f'static const uint8_t {symbol}[] PROGMEM = {{')
+        out.append(c_bytes(container))
+        out.append('};')
+        out.append(f'#define {symbol}_SIZE {len(container)}')
+        out.append('')
+        print(f"Screen {symbol}: {len(container)} bytes")
+
+    out.append('#endif // SCREEN_ASSETS_H')
+    content = '\n'.join(out) + '\n'
+
+    # Leave the header untouched when nothing changed, so it does not
+    # trigger a rebuild of everything that includes it
+    if os.path.exists(output_path):
+        with open(output_path, encoding='utf-8') as f:
+            if f.read() == content:
+                return output_path
+
+    with open(output_path, 'w', encoding='utf-8') as f:
+        f.write(content)
+    print(f"Screen assets saved to: {output_path}")
+    return output_path
+
+
+try:
+    Import('env')  # noqa: F821 - provided by PlatformIO when run as an extra script
+    generate_header(env.subst('$PROJECT_DIR'))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        generate_header(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Web Asset Embedder for the ESP32-S2 Smart Dashboard firmware.
+
+Gzips the configuration portal pages in web/ and writes them as byte arrays
+into include/web_assets.h, so the firmware can send them straight from flash
+with Content-Encoding: gzip instead of building them in the heap.
+
+Runs automatically before every PlatformIO build (extra_scripts in
+platformio.ini) and only rewrites the header when its content changes.
+
+Usage (from the Firmware directory):
+    python scripts/embed_web_assets.py
+"""
+
+import gzip
+import os
+
+# (source file, C symbol, MIME type)
+WEB_ASSETS = [
+    ('index.html', 'WEB_INDEX_HTML', 'text/html'),
+    ('success.html', 'WEB_SUCCESS_HTML', 'text/html'),
+]
+
+
+def minify(text: str) -> str:
+    """Drop indentation and blank lines - the pages have no whitespace-sensitive content."""
+    return '\n'.join(line.strip() for line in text.splitlines() if line.strip()) + '\n'
+
+
+def c_bytes(data: bytes, indent: str = '    ') -> str:
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def generate_header(firmware_dir: str) -> str:
+    web_dir = os.path.join(firmware_dir, 'web')
+    output_path = os.path.join(firmware_dir, 'include', 'web_assets.h')
+    out = [
+        '// Generated by scripts/embed_web_assets.py from web/ - do not edit',
+        '#ifndef WEB_ASSETS_H',
+        '#define WEB_ASSETS_H',
+        '',
+        '#include <Arduino.h>',
+        '',
+    ]
+
+    for filename, symbol, mime in WEB_ASSETS:
+        with open(os.path.join(web_dir, filename), encoding='utf-8') as f:
+            raw = minify(f.read()).encode('utf-8')
+        # mtime=0 keeps the output identical between builds
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+
+        out.append(f'// {filename}: {len(raw)} bytes, {len(packed)} gzipped')
+        out.append(f'static const uint8_t {symbol}[] PROGMEM = {{')
+        out.append(c_bytes(packed))
+        out.append('};')
+        out.append(f'#define {symbol}_SIZE {len(packed)}')
+        out.append(f'#define {symbol}_TYPE "{mime}"')
+        out.append('')
+        print(f"Web asset {filename}: {len(raw)} -> {len(packed)} bytes")
+
+    out.append('#endif // WEB_ASSETS_H')
+    content = '\n'.join(out) + '\n'
+
+    # Leave the header untouched when nothing changed, so it does not
+    # trigger a rebuild of everything that includes it
+    if os.path.exists(output_path):
+        with open(output_path, encoding='utf-8') as f:
+            if f.read() == content:
+                return output_path
+
+    with open(output_path, 'w', encoding='utf-8') as f:
+        f.write(content)
+    print(f"Web assets saved to: {output_path}")
+    return output_path
+
+
+try:
+    Import('env')  # noqa: F821 - provided by PlatformIO when run as an extra script
+    generate_header(env.subst('$PROJECT_DIR'))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        generate_header(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+Firmware publisher for over-the-air updates of the ESP32-S2 Smart Dashboard.
+
+Compresses the application image built by PlatformIO with zlib and writes it,
+together with firmware/manifest.json, into a checkout of the server
+repository the devices fetch their frames from. Commit and push the
+firmware/ directory afterwards; devices check the manifest at most every
+OTA_CHECK_INTERVAL_S during a normal update wake.
+
+The build number comes from FIRMWARE_BUILD in include/config.h and has to be
+higher than the one the devices run, or they ignore the image.
+
+Usage (from the Firmware directory):
+    pio run -e esp32-s2
+    python scripts/publish_firmware.py ../Server
+"""
+
+import argparse
+import glob
+import hashlib
+import json
+import os
+import re
+import sys
+import zlib
+
+MANIFEST_VERSION = 1                 # MANIFEST_VERSION in include/config.h
+OTA_MAX_IMAGE_SIZE = 0x140000        # OTA_MAX_IMAGE_SIZE in include/config.h
+FIRMWARE_DIR = 'firmware'            # Directory of OTA_MANIFEST_PATH
+DEFAULT_IMAGE = os.path.join('.pio', 'build', 'esp32-s2', 'firmware.bin')
+
+
+def read_define(config_path: str, name: str) -> str:
+    with open(config_path, encoding='utf-8') as f:
+        match = re.search(rf'^#define\s+{name}\s+(\S+)', f.read(), re.MULTILINE)
+    if not match:
+        sys.exit(f"{name} not found in {config_path}")
+    return match.group(1).strip('"')
+
+
+def publish(firmware_dir: str, image_path: str, server_dir: str) -> str:
+    config_path = os.path.join(firmware_dir, 'include', 'config.h')
+    build = int(read_define(config_path, 'FIRMWARE_BUILD'))
+    version = read_define(config_path, 'FIRMWARE_VERSION')
+
+    with open(image_path, 'rb') as f:
+        image = f.read()
+    if len(image) > OTA_MAX_IMAGE_SIZE:
+        sys.exit(f"Image is {len(image)} bytes, the OTA partition holds {OTA_MAX_IMAGE_SIZE}")
+
+    # Full 32 KB window (wbits=15), which the device inflater is sized for
+    compressor = zlib.compressobj(9, zlib.DEFLATED, 15)
+    packed = compressor.compress(image) + compressor.flush()
+
+    output_dir = os.path.join(server_dir, FIRMWARE_DIR)
+    os.makedirs(output_dir, exist_ok=True)
+
+    # A new name per build, so a CDN copy of an older image can never be
+    # paired with the new manifest
+    filename = f'firmware-{build}.bin.z'
+    for old in glob.glob(os.path.join(output_dir, 'firmware-*.bin.z')):
+        if os.path.basename(old) != filename:
+            os.remove(old)
+    with open(os.path.join(output_dir, filename), 'wb') as f:
+        f.write(packed)
+
+    manifest = {
+        'version': MANIFEST_VERSION,
+        'build': build,
+        'name': version,
+        'file': f'{FIRMWARE_DIR}/{filename}',
+        'codec': 'zlib',
+        'size': len(packed),
+        'image_size': len(image),
+        'sha256': hashlib.sha256(image).hexdigest(),
+    }
+    manifest_path = os.path.join(output_dir, 'manifest.json')
+    with open(manifest_path, 'w', encoding='utf-8') as f:
+        json.dump(manifest, f, indent=2)
+        f.write('\n')
+
+    print(f"Firmware {version} (build {build}): {len(image)} -> {len(packed)} bytes "
+          f"({len(packed) * 100 / len(image):.1f}%)")
+    print(f"Manifest saved to: {manifest_path}")
+    return manifest_path
+
+
+if __name__ == "__main__":
+    firmware_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description="Publish a firmware image for OTA updates")
+    parser.add_argument('server_dir', help="checkout of the server repository the devices use")
+    parser.add_argument('--image', default=os.path.join(firmware_dir, DEFAULT_IMAGE),
+                        help="application image (default: the esp32-s2 PlatformIO build)")
+    args = parser.parse_args()
+    publish(firmware_dir, args.image, args.server_dir)
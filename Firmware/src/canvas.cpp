@@ -0,0 +1,148 @@
+#include "canvas.h"
+#include "font5x7.h"
+#include <string.h>
+
+Canvas::Canvas(uint8_t* buffer, int width, int height) : 
+    buffer(buffer), width(width), height(height), rowBytes((width + 1) / 2) {
+}
+
+void Canvas::fill(uint8_t color) {
+    fillRect(0, 0, width, height, color);
+}
+
+void Canvas::fillRect(int x, int y, int w, int h, uint8_t color) {
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + w > width ? width : x + w;
+    int y1 = y + h > height ? height : y + h;
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    // Full-width fills are one contiguous span
+    if (x0 == 0 && x1 == width && (width % 2) == 0) {
+        fillSpan(buffer + (size_t)y0 * rowBytes, 0, width * (y1 - y0), color);
+        return;
+    }
+    
+    for (int row = y0; row < y1; row++) {
+        fillSpan(buffer + (size_t)row * rowBytes, x0, x1, color);
+    }
+}
+
+void Canvas::fillSpan(uint8_t* row, int x0, int x1, uint8_t color) {
+    color &= 0x0F;
+    
+    // Odd start pixel is the low nibble of its byte
+    if (x0 & 1) {
+        row[x0 / 2] = (row[x0 / 2] & 0xF0) | color;
+        x0++;
+    }
+    
+    uint8_t* dst = row + x0 / 2;
+    uint8_t* end = row + x1 / 2;
+    uint8_t pair = (color << 4) | color;
+    
+    // Byte fill up to word alignment, then 8 pixels per 32-bit store
+    while (dst < end && ((uintptr_t)dst & 3)) {
+        *dst++ = pair;
+    }
+    uint32_t word = pair * 0x01010101u;
+    while (end - dst >= 4) {
+        *(uint32_t*)dst = word;
+        dst += 4;
+    }
+    while (dst < end) {
+        *dst++ = pair;
+    }
+    
+    // Odd end pixel is the high nibble of the last byte
+    if (x1 & 1) {
+        row[x1 / 2] = (row[x1 / 2] & 0x0F) | (color << 4);
+    }
+}
+
+void Canvas::setPixel(int x, int y, uint8_t color) {
+    if (x < 0 || x >= width || y < 0 || y >= height) return;
+    
+    uint8_t& byte = buffer[(size_t)y * rowBytes + x / 2];
+    if (x & 1) {
+        byte = (byte & 0xF0) | (color & 0x0F);
+    } else {
+        byte = (byte & 0x0F) | (color << 4);
+    }
+}
+
+void Canvas::blit(const uint8_t* sprite, int x, int y, int spriteWidth, int spriteHeight) {
+    int spriteRowBytes = (spriteWidth + 1) / 2;
+    int x0 = x < 0 ? 0 : x;
+    int x1 = x + spriteWidth > width ? width : x + spriteWidth;
+    
+    for (int row = 0; row < spriteHeight; row++) {
+        int dy = y + row;
+        if (dy < 0 || dy >= height || x0 >= x1) continue;
+        
+        const uint8_t* src = sprite + (size_t)row * spriteRowBytes;
+        uint8_t* dst = buffer + (size_t)dy * rowBytes;
+        
+        // Nibble-aligned sprites copy whole bytes
+        if (((x0 - x) & 1) == 0 && (x0 & 1) == 0) {
+            int bytes = (x1 - x0) / 2;
+            memcpy(dst + x0 / 2, src + (x0 - x) / 2, bytes);
+            if ((x1 - x0) & 1) {
+                setPixel(x1 - 1, dy, src[(x1 - 1 - x) / 2] >> 4);
+            }
+            continue;
+        }
+        
+        for (int dx = x0; dx < x1; dx++) {
+            int sx = dx - x;
+            uint8_t pixels = src[sx / 2];
+            setPixel(dx, dy, (sx & 1) ? pixels & 0x0F : pixels >> 4);
+        }
+    }
+}
+
+void Canvas::drawGlyph(char c, int x, int y, int scale, uint8_t color) {
+    if (c < FONT5X7_FIRST || c > FONT5X7_LAST) {
+        c = '?';
+    }
+    const uint8_t* glyph = FONT5X7[c - FONT5X7_FIRST];
+    
+    // Each vertical run of set bits is one rectangle
+    for (int col = 0; col < FONT5X7_WIDTH; col++) {
+        uint8_t bits = glyph[col];
+        int row = 0;
+        while (bits) {
+            if (!(bits & 1)) {
+                bits >>= 1;
+                row++;
+                continue;
+            }
+            int start = row;
+            while (bits & 1) {
+                bits >>= 1;
+                row++;
+            }
+            fillRect(x + col * scale, y + start * scale, scale, (row - start) * scale, color);
+        }
+    }
+}
+
+int Canvas::drawText(const char* text, int x, int y, int scale, uint8_t color) {
+    for (const char* p = text; *p; p++) {
+        if (*p != ' ') {
+            drawGlyph(*p, x, y, scale, color);
+        }
+        x += FONT5X7_ADVANCE * scale;
+    }
+    return x;
+}
+
+int Canvas::drawTextCentered(const char* text, int y, int scale, uint8_t color) {
+    return drawText(text, (width - textWidth(text, scale)) / 2, y, scale, color);
+}
+
+int Canvas::textWidth(const char* text, int scale) {
+    int length = strlen(text);
+    // No spacing column after the last glyph
+    return length > 0 ? (length * FONT5X7_ADVANCE - 1) * scale : 0;
+}
@@ -0,0 +1,168 @@
+#include "color_quantizer.h"
+#include "palette_lut.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+static inline int clamp8(int value) {
+    return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+ColorQuantizer::ColorQuantizer() :
+    output(nullptr), format(PIXEL_RGB888), rowBytes(0), rowFill(0), rowsDone(0),
+    frameActive(false), outputFailed(false),
+    currentError(errorRows[0]), nextError(errorRows[1]) {
+    memset(errorRows, 0, sizeof(errorRows));
+}
+
+bool ColorQuantizer::beginFrame(size_t frameSize) {
+    if (!output) return false;
+
+    size_t pixels = (size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT;
+    if (frameSize == pixels * 3) {
+        format = PIXEL_RGB888;
+        rowBytes = DISPLAY_WIDTH * 3;
+    } else if (frameSize == pixels * 2) {
+        format = PIXEL_RGB565;
+        rowBytes = DISPLAY_WIDTH * 2;
+    } else {
+        Serial.printf("Not a %dx%d RGB888/RGB565 image: %u bytes\n",
+                      DISPLAY_WIDTH, DISPLAY_HEIGHT, (unsigned)frameSize);
+        return false;
+    }
+
+    // The first row has no error carried in from above
+    memset(errorRows, 0, sizeof(errorRows));
+    currentError = errorRows[0];
+    nextError = errorRows[1];
+    rowFill = 0;
+    rowsDone = 0;
+    outputFailed = false;
+
+    if (!output->beginFrame(DISPLAY_FRAME_SIZE)) {
+        return false;
+    }
+
+    Serial.printf("Quantizing %s image to the panel palette\n",
+                  format == PIXEL_RGB888 ? "RGB888" : "RGB565");
+    frameActive = true;
+    return true;
+}
+
+bool ColorQuantizer::writeFrame(const uint8_t* data, size_t length) {
+    if (!frameActive || outputFailed) return false;
+
+    while (length > 0) {
+        // Whole rows are quantized straight from the caller's chunk
+        if (rowFill == 0 && length >= rowBytes) {
+            if (!emitRow(data)) return false;
+            data += rowBytes;
+            length -= rowBytes;
+            continue;
+        }
+
+        // Rows split across chunks are gathered first
+        size_t take = min(length, rowBytes - rowFill);
+        memcpy(inputRow + rowFill, data, take);
+        rowFill += take;
+        data += take;
+        length -= take;
+
+        if (rowFill == rowBytes) {
+            rowFill = 0;
+            if (!emitRow(inputRow)) return false;
+        }
+    }
+    return true;
+}
+
+bool ColorQuantizer::endFrame(bool commit) {
+    if (!frameActive) return false;
+    frameActive = false;
+
+    bool complete = commit && !outputFailed && rowsDone == DISPLAY_HEIGHT;
+    if (commit && !complete) {
+        Serial.printf("Image incomplete: %d/%d rows quantized\n", rowsDone, DISPLAY_HEIGHT);
+    }
+    return output->endFrame(complete);
+}
+
+bool ColorQuantizer::emitRow(const uint8_t* pixels) {
+    // Anything past the last row is ignored, like the panel does
+    if (rowsDone >= DISPLAY_HEIGHT) return true;
+
+    quantizeRow(pixels, packedRow);
+    rowsDone++;
+
+    if (!output->writeFrame(packedRow, DISPLAY_ROW_BYTES)) {
+        outputFailed = true;
+        return false;
+    }
+    return true;
+}
+
+void ColorQuantizer::quantizeRow(const uint8_t* pixels, uint8_t* packed) {
+    // Skip the left padding pixel; the next row starts out error-free
+    int16_t* current = currentError + 3;
+    int16_t* next = nextError + 3;
+    memset(nextError, 0, sizeof(errorRows[0]));
+
+    uint8_t highNibble = 0;
+    for (int x = 0; x < DISPLAY_WIDTH; x++) {
+        int r, g, b;
+        if (format == PIXEL_RGB888) {
+            r = pixels[0];
+            g = pixels[1];
+            b = pixels[2];
+            pixels += 3;
+        } else {
+            uint16_t value = pixels[0] | (pixels[1] << 8);
+            r = (value >> 11) & 0x1F;
+            g = (value >> 5) & 0x3F;
+            b = value & 0x1F;
+            r = (r << 3) | (r >> 2);
+            g = (g << 2) | (g >> 4);
+            b = (b << 3) | (b >> 2);
+            pixels += 2;
+        }
+
+        // Add the diffused error (rounded from 1/16 units)
+        int16_t* error = current + x * 3;
+        r = clamp8(r + ((error[0] + 8) >> 4));
+        g = clamp8(g + ((error[1] + 8) >> 4));
+        b = clamp8(b + ((error[2] + 8) >> 4));
+
+        uint8_t color = PALETTE_LUT[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+        const uint8_t* ink = PALETTE_RGB[color];
+        int errR = r - ink[0];
+        int errG = g - ink[1];
+        int errB = b - ink[2];
+
+        //       X   7/16
+        // 3/16 5/16 1/16
+        error[3] += errR * 7;
+        error[4] += errG * 7;
+        error[5] += errB * 7;
+
+        int16_t* below = next + x * 3;
+        below[-3] += errR * 3;
+        below[-2] += errG * 3;
+        below[-1] += errB * 3;
+        below[0] += errR * 5;
+        below[1] += errG * 5;
+        below[2] += errB * 5;
+        below[3] += errR;
+        below[4] += errG;
+        below[5] += errB;
+
+        // Two pixels per byte, left pixel in the high nibble
+        if (x & 1) {
+            packed[x >> 1] = highNibble | color;
+        } else {
+            highNibble = color << 4;
+        }
+    }
+
+    int16_t* swap = currentError;
+    currentError = nextError;
+    nextError = swap;
+}
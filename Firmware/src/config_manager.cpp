@@ -1,64 +1,56 @@
 #include "config_manager.h"
 #include "config.h"
+#include "frame_format.h"
 #include "serial_config.h"  // Must be included before Arduino.h
 #include <Arduino.h>
 
 ConfigManager::ConfigManager() : configLoaded(false) {
     memset(&config, 0, sizeof(config));
+    memset(repoURL, 0, sizeof(repoURL));
+    memset(viewURLs, 0, sizeof(viewURLs));
 }
 
+// NVS record: header followed by the DashboardConfig of that version
+struct StoredConfigHeader {
+    uint16_t magic;
+    uint16_t version;
+    uint32_t payloadSize;
+    uint32_t crc;          // CRC-32 of the payload
+};
+
+struct StoredConfig {
+    StoredConfigHeader header;
+    DashboardConfig payload;
+};
+
 bool ConfigManager::init() {
-    if (!EEPROM.begin(EEPROM_SIZE)) {
-        Serial.println("Failed to initialize EEPROM");
+    if (!prefs.begin(CONFIG_NVS_NAMESPACE, false)) {
+        Serial.println("Failed to open configuration storage");
         return false;
     }
     
-    Serial.println("EEPROM initialized successfully");
+    Serial.println("Configuration storage opened");
     return loadConfig();
 }
 
 bool ConfigManager::loadConfig() {
-    Serial.println("Loading configuration from EEPROM...");
+    Serial.println("Loading configuration from NVS...");
     
-    // Read magic number first to check if config exists
-    uint16_t magicNumber;
-    EEPROM.get(EEPROM_CONFIG_FLAG_ADDR, magicNumber);
+    memset(&config, 0, sizeof(config));
+    configLoaded = true;
     
-    if (magicNumber != CONFIG_MAGIC_NUMBER) {
-        Serial.println("No valid configuration found in EEPROM");
+    if (!readStoredConfig() && !migrateFromEEPROM()) {
+        Serial.println("No valid configuration found");
         config.isConfigured = false;
         config.magicNumber = 0;
-        configLoaded = true;
         return false;
     }
     
-    // Read WiFi credentials
-    for (int i = 0; i < MAX_SSID_LENGTH; i++) {
-        config.wifiSSID[i] = EEPROM.read(EEPROM_WIFI_SSID_ADDR + i);
-    }
-    config.wifiSSID[MAX_SSID_LENGTH] = '\0';
-    
-    for (int i = 0; i < MAX_PASSWORD_LENGTH; i++) {
-        config.wifiPassword[i] = EEPROM.read(EEPROM_WIFI_PASS_ADDR + i);
-    }
-    config.wifiPassword[MAX_PASSWORD_LENGTH] = '\0';
-    
-    // Read GitHub info
-    for (int i = 0; i < MAX_REPO_LENGTH; i++) {
-        config.githubRepo[i] = EEPROM.read(EEPROM_GITHUB_REPO_ADDR + i);
-    }
-    config.githubRepo[MAX_REPO_LENGTH] = '\0';
-    
-    for (int i = 0; i < MAX_PATH_LENGTH; i++) {
-        config.githubImagePath[i] = EEPROM.read(EEPROM_GITHUB_PATH_ADDR + i);
-    }
-    config.githubImagePath[MAX_PATH_LENGTH] = '\0';
-    
-    config.magicNumber = magicNumber;
+    config.magicNumber = CONFIG_MAGIC_NUMBER;
     config.isConfigured = validateConfig();
-    configLoaded = true;
     
     if (config.isConfigured) {
+        buildURLs();
         Serial.println("Configuration loaded successfully!");
         printConfig();
         return true;
@@ -68,47 +60,120 @@ bool ConfigManager::loadConfig() {
     }
 }
 
-bool ConfigManager::saveConfig() {
-    Serial.println("Saving configuration to EEPROM...");
+bool ConfigManager::readStoredConfig() {
+    // One read for the whole record; older, shorter versions fit as well
+    StoredConfig stored;
+    size_t length = prefs.getBytes(CONFIG_NVS_KEY, &stored, sizeof(stored));
     
-    if (!validateConfig()) {
-        Serial.println("Cannot save invalid configuration");
+    if (length < sizeof(StoredConfigHeader)) {
+        return false;
+    }
+    
+    const StoredConfigHeader& header = stored.header;
+    size_t payloadSize = length - sizeof(StoredConfigHeader);
+    
+    if (header.magic != CONFIG_MAGIC_NUMBER || header.payloadSize != payloadSize ||
+        header.version > CONFIG_VERSION) {
+        Serial.printf("Stored configuration has an unknown layout (version %d, %u bytes)\n", 
+                      header.version, (unsigned)payloadSize);
         return false;
     }
     
-    // Write WiFi credentials
-    for (int i = 0; i < MAX_SSID_LENGTH; i++) {
-        EEPROM.write(EEPROM_WIFI_SSID_ADDR + i, 
-                    i < strlen(config.wifiSSID) ? config.wifiSSID[i] : 0);
+    if (frameCrc32(0, (const uint8_t*)&stored.payload, payloadSize) != header.crc) {
+        Serial.println("Stored configuration failed its CRC check");
+        return false;
     }
     
-    for (int i = 0; i < MAX_PASSWORD_LENGTH; i++) {
-        EEPROM.write(EEPROM_WIFI_PASS_ADDR + i, 
-                    i < strlen(config.wifiPassword) ? config.wifiPassword[i] : 0);
+    // Layouts only grow at the end, so an older payload is a prefix of the
+    // current one; the fields it lacks are filled in by the migration
+    memcpy(&config, &stored.payload, payloadSize);
+    
+    if (header.version != CONFIG_VERSION) {
+        Serial.printf("Migrating configuration from version %d to %d\n", header.version, CONFIG_VERSION);
+        if (!migrateConfig(header.version)) {
+            return false;
+        }
+        saveConfig();
     }
+    return true;
+}
+
+bool ConfigManager::migrateConfig(uint16_t fromVersion) {
+    // Bring an older record up one version per step; cases fall through.
+    // Version 1 was the EEPROM layout, handled by migrateFromEEPROM().
+    switch (fromVersion) {
+        case 2:
+            // Version 3 adds the playlist; older records show a single view
+            config.playlistLength = 0;
+            config.dwellMinutes = PLAYLIST_DEFAULT_DWELL_MIN;
+            memset(config.playlist, 0, sizeof(config.playlist));
+            // fall through
+        default:
+            break;
+    }
+    return fromVersion >= 2;
+}
+
+bool ConfigManager::migrateFromEEPROM() {
+    // The EEPROM emulation keeps its whole 512-byte sector as one blob in
+    // its own NVS namespace; read it directly instead of mapping it in
+    Preferences legacy;
+    if (!legacy.begin(EEPROM_NVS_NAMESPACE, true)) {
+        return false;
+    }
+    
+    uint8_t sector[EEPROM_SIZE];
+    size_t length = legacy.getBytes(EEPROM_NVS_NAMESPACE, sector, sizeof(sector));
+    legacy.end();
     
-    // Write GitHub info
-    for (int i = 0; i < MAX_REPO_LENGTH; i++) {
-        EEPROM.write(EEPROM_GITHUB_REPO_ADDR + i, 
-                    i < strlen(config.githubRepo) ? config.githubRepo[i] : 0);
+    uint16_t magicNumber = 0;
+    if (length == sizeof(sector)) {
+        memcpy(&magicNumber, sector + EEPROM_CONFIG_FLAG_ADDR, sizeof(magicNumber));
+    }
+    if (magicNumber != CONFIG_MAGIC_NUMBER) {
+        return false;
     }
     
-    for (int i = 0; i < MAX_PATH_LENGTH; i++) {
-        EEPROM.write(EEPROM_GITHUB_PATH_ADDR + i, 
-                    i < strlen(config.githubImagePath) ? config.githubImagePath[i] : 0);
+    Serial.println("Migrating configuration from EEPROM to NVS...");
+    memcpy(config.wifiSSID, sector + EEPROM_WIFI_SSID_ADDR, MAX_SSID_LENGTH);
+    memcpy(config.wifiPassword, sector + EEPROM_WIFI_PASS_ADDR, MAX_PASSWORD_LENGTH);
+    memcpy(config.githubRepo, sector + EEPROM_GITHUB_REPO_ADDR, MAX_REPO_LENGTH);
+    memcpy(config.githubImagePath, sector + EEPROM_GITHUB_PATH_ADDR, MAX_PATH_LENGTH);
+    
+    // Only drop the old sector once the new record is safely written
+    if (validateConfig() && saveConfig() && legacy.begin(EEPROM_NVS_NAMESPACE, false)) {
+        legacy.clear();
+        legacy.end();
+    }
+    return true;
+}
+
+bool ConfigManager::saveConfig() {
+    Serial.println("Saving configuration to NVS...");
+    
+    if (!validateConfig()) {
+        Serial.println("Cannot save invalid configuration");
+        return false;
     }
     
-    // Write magic number last to indicate valid config
     config.magicNumber = CONFIG_MAGIC_NUMBER;
-    EEPROM.put(EEPROM_CONFIG_FLAG_ADDR, config.magicNumber);
     
-    // Commit changes to EEPROM
-    if (EEPROM.commit()) {
+    StoredConfig stored;
+    stored.header.magic = CONFIG_MAGIC_NUMBER;
+    stored.header.version = CONFIG_VERSION;
+    stored.header.payloadSize = sizeof(stored.payload);
+    stored.payload = config;
+    stored.payload.isConfigured = true;
+    stored.header.crc = frameCrc32(0, (const uint8_t*)&stored.payload, sizeof(stored.payload));
+    
+    // NVS writes the record atomically - a power cut leaves the old one
+    if (prefs.putBytes(CONFIG_NVS_KEY, &stored, sizeof(stored)) == sizeof(stored)) {
         config.isConfigured = true;
+        buildURLs();
         Serial.println("Configuration saved successfully!");
         return true;
     } else {
-        Serial.println("Failed to commit configuration to EEPROM");
+        Serial.println("Failed to write configuration to NVS");
         return false;
     }
 }
@@ -116,12 +181,7 @@ bool ConfigManager::saveConfig() {
 void ConfigManager::clearConfig() {
     Serial.println("Clearing configuration...");
     
-    // Clear all EEPROM data
-    for (int i = 0; i < EEPROM_SIZE; i++) {
-        EEPROM.write(i, 0);
-    }
-    
-    EEPROM.commit();
+    prefs.remove(CONFIG_NVS_KEY);
     
     // Reset config structure
     memset(&config, 0, sizeof(config));
@@ -172,15 +232,16 @@ bool ConfigManager::loadDefaultConfig() {
     
     config.isConfigured = true;
     configLoaded = true;
+    buildURLs();
     
     if (SHOW_DEFAULT_CONFIG) {
         Serial.println("Default configuration loaded successfully!");
         printConfig();
     }
     
-    // Optionally save the default config to EEPROM so it persists
+    // Optionally save the default config to NVS so it persists
     if (FORCE_DEFAULT_CONFIG) {
-        Serial.println("Force default config enabled - saving to EEPROM");
+        Serial.println("Force default config enabled - saving to NVS");
         return saveConfig();
     }
     
@@ -225,6 +286,67 @@ void ConfigManager::setConfigured(bool configured) {
     config.isConfigured = configured;
 }
 
+const char* ConfigManager::getViewPath(uint8_t view) const {
+    if (view == 0 || view > config.playlistLength) {
+        return config.githubImagePath;
+    }
+    return config.playlist[view - 1];
+}
+
+const char* ConfigManager::getViewURL(uint8_t view) const {
+    return viewURLs[view < getViewCount() ? view : 0];
+}
+
+void ConfigManager::buildURLs() {
+    // GitHub raw URL format: https://raw.githubusercontent.com/owner/repo/branch/path
+    snprintf(repoURL, sizeof(repoURL), "https://" GITHUB_HOST "/%s/main/", config.githubRepo);
+    
+    // Image paths name the frame; the fetcher appends the file it wants
+    for (uint8_t view = 0; view < PLAYLIST_MAX_VIEWS; view++) {
+        const char* path = view < getViewCount() ? getViewPath(view) : "";
+        size_t length = strlen(path);
+        if (length > 4 && (!strcmp(path + length - 4, ".png") || !strcmp(path + length - 4, ".bin") || 
+                           !strcmp(path + length - 4, ".epf"))) {
+            length -= 4;
+        }
+        snprintf(viewURLs[view], sizeof(viewURLs[view]), "%s%.*s", repoURL, (int)length, path);
+    }
+}
+
+uint32_t ConfigManager::getDwellSeconds() const {
+    uint16_t minutes = config.dwellMinutes > 0 ? config.dwellMinutes : PLAYLIST_DEFAULT_DWELL_MIN;
+    return (uint32_t)minutes * 60;
+}
+
+void ConfigManager::clearPlaylist() {
+    config.playlistLength = 0;
+    memset(config.playlist, 0, sizeof(config.playlist));
+}
+
+bool ConfigManager::addPlaylistPath(const char* path) {
+    if (!path || strlen(path) == 0 || strlen(path) > MAX_PATH_LENGTH || 
+        config.playlistLength >= PLAYLIST_MAX_VIEWS - 1) {
+        Serial.println("Invalid or too many playlist paths");
+        return false;
+    }
+    
+    char* entry = config.playlist[config.playlistLength++];
+    strncpy(entry, path, MAX_PATH_LENGTH);
+    entry[MAX_PATH_LENGTH] = '\0';
+    
+    Serial.printf("Playlist view %d: %s\n", config.playlistLength, entry);
+    return true;
+}
+
+bool ConfigManager::setDwellMinutes(uint16_t minutes) {
+    if (minutes == 0 || minutes > PLAYLIST_MAX_DWELL_MIN) {
+        Serial.println("Invalid playlist dwell time");
+        return false;
+    }
+    config.dwellMinutes = minutes;
+    return true;
+}
+
 bool ConfigManager::validateConfig() const {
     if (strlen(config.wifiSSID) == 0) {
         Serial.println("Validation failed: WiFi SSID is empty");
@@ -247,6 +369,11 @@ bool ConfigManager::validateConfig() const {
         return false;
     }
     
+    if (config.playlistLength > PLAYLIST_MAX_VIEWS - 1) {
+        Serial.println("Validation failed: playlist is too long");
+        return false;
+    }
+    
     return true;
 }
 
@@ -259,6 +386,12 @@ String ConfigManager::getConfigJson() const {
     doc["githubImagePath"] = config.githubImagePath;
     doc["isConfigured"] = config.isConfigured;
     
+    JsonArray playlist = doc["playlist"].to<JsonArray>();
+    for (uint8_t i = 0; i < config.playlistLength; i++) {
+        playlist.add(config.playlist[i]);
+    }
+    doc["dwellMinutes"] = getDwellSeconds() / 60;
+    
     String jsonString;
     serializeJson(doc, jsonString);
     return jsonString;
@@ -288,6 +421,17 @@ bool ConfigManager::setConfigFromJson(const String& jsonStr) {
         return false;
     }
     
+    // Optional; a missing playlist means a single view
+    clearPlaylist();
+    for (JsonVariant path : doc["playlist"].as<JsonArray>()) {
+        if (!path.is<const char*>() || !addPlaylistPath(path.as<const char*>())) {
+            return false;
+        }
+    }
+    if (!doc["dwellMinutes"].isNull() && !setDwellMinutes(doc["dwellMinutes"] | 0)) {
+        return false;
+    }
+    
     return validateConfig();
 }
 
@@ -297,6 +441,12 @@ void ConfigManager::printConfig() const {
     Serial.printf("WiFi Password: %s\n", strlen(config.wifiPassword) > 0 ? "***set***" : "***empty***");
     Serial.printf("GitHub Repo: %s\n", config.githubRepo);
     Serial.printf("GitHub Image Path: %s\n", config.githubImagePath);
+    for (uint8_t i = 0; i < config.playlistLength; i++) {
+        Serial.printf("Playlist View %d: %s\n", i + 1, config.playlist[i]);
+    }
+    if (config.playlistLength > 0) {
+        Serial.printf("Minutes Per View: %u\n", getDwellSeconds() / 60);
+    }
     Serial.printf("Is Configured: %s\n", config.isConfigured ? "Yes" : "No");
     Serial.printf("Magic Number: 0x%04X\n", config.magicNumber);
     Serial.println("=============================");
@@ -0,0 +1,192 @@
+#include "delta_patcher.h"
+#include "config.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+DeltaPatcher::DeltaPatcher() : 
+    output(nullptr), base(nullptr), stage(STAGE_HEADER), fieldBytes(0), rectsLeft(0), 
+    rowsLeft(0), rowBytesLeft(0), framePos(0), crc(0), outputStarted(false), unchanged(false) {
+    memset(&header, 0, sizeof(header));
+    memset(&rect, 0, sizeof(rect));
+}
+
+bool DeltaPatcher::beginFrame(size_t) {
+    if (!output || !base || !base->hasFrame()) {
+        Serial.println("No cached base frame - cannot apply delta");
+        return false;
+    }
+    
+    stage = STAGE_HEADER;
+    fieldBytes = 0;
+    rectsLeft = 0;
+    rowsLeft = 0;
+    rowBytesLeft = 0;
+    framePos = 0;
+    crc = 0;
+    outputStarted = false;
+    unchanged = false;
+    return true;
+}
+
+bool DeltaPatcher::writeFrame(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        switch (stage) {
+            case STAGE_HEADER:
+                if (collect(&header, sizeof(header), data, length) && !startPatching()) {
+                    stage = STAGE_ERROR;
+                }
+                break;
+                
+            case STAGE_RECT:
+                if (collect(&rect, sizeof(rect), data, length) && !startRect()) {
+                    stage = STAGE_ERROR;
+                }
+                break;
+                
+            case STAGE_DATA: {
+                // Each rectangle row replaces one contiguous span of the frame
+                if (rowBytesLeft == 0) {
+                    size_t row = rect.y + rect.height - rowsLeft;
+                    if (!copyBase(row * DISPLAY_ROW_BYTES + rect.x / 2)) {
+                        stage = STAGE_ERROR;
+                        break;
+                    }
+                    rowBytesLeft = rect.width / 2;
+                }
+                
+                size_t count = min(length, rowBytesLeft);
+                if (!emit(data, count)) {
+                    stage = STAGE_ERROR;
+                    break;
+                }
+                data += count;
+                length -= count;
+                rowBytesLeft -= count;
+                
+                if (rowBytesLeft == 0 && --rowsLeft == 0) {
+                    stage = --rectsLeft > 0 ? STAGE_RECT : STAGE_DONE;
+                }
+                break;
+            }
+            
+            case STAGE_DONE:
+                Serial.println("Delta payload has data past its last rectangle");
+                stage = STAGE_ERROR;
+                break;
+                
+            case STAGE_ERROR:
+                return false;
+        }
+    }
+    return stage != STAGE_ERROR;
+}
+
+bool DeltaPatcher::endFrame(bool commit) {
+    bool complete = commit && stage == STAGE_DONE;
+    
+    if (!outputStarted) {
+        base->closeReader();
+        return complete && unchanged;
+    }
+    outputStarted = false;
+    
+    // Everything below the last rectangle is unchanged
+    if (complete) {
+        complete = copyBase(DISPLAY_FRAME_SIZE);
+    }
+    base->closeReader();
+    
+    if (complete && crc != header.targetCrc) {
+        Serial.printf("Patched frame CRC %08X does not match %08X\n", crc, header.targetCrc);
+        complete = false;
+    }
+    
+    return output->endFrame(complete) && complete;
+}
+
+bool DeltaPatcher::collect(void* field, size_t fieldSize, const uint8_t*& data, size_t& length) {
+    size_t take = min(length, fieldSize - fieldBytes);
+    memcpy((uint8_t*)field + fieldBytes, data, take);
+    fieldBytes += take;
+    data += take;
+    length -= take;
+    
+    if (fieldBytes < fieldSize) return false;
+    fieldBytes = 0;
+    return true;
+}
+
+bool DeltaPatcher::startPatching() {
+    if (header.magic != FRAME_DELTA_MAGIC) {
+        Serial.println("Invalid delta payload");
+        return false;
+    }
+    
+    if (header.baseCrc != base->getFrameCrc()) {
+        Serial.printf("Delta base %08X does not match cached frame %08X\n", 
+                      header.baseCrc, base->getFrameCrc());
+        return false;
+    }
+    
+    if (header.rectCount == 0 || header.targetCrc == header.baseCrc) {
+        Serial.println("Delta has no changes - panel already shows this frame");
+        unchanged = true;
+        stage = STAGE_DONE;
+        return true;
+    }
+    
+    Serial.printf("Applying %d patch rectangles\n", header.rectCount);
+    
+    if (!output->beginFrame(DISPLAY_FRAME_SIZE)) {
+        return false;
+    }
+    outputStarted = true;
+    rectsLeft = header.rectCount;
+    stage = STAGE_RECT;
+    return true;
+}
+
+bool DeltaPatcher::startRect() {
+    bool valid = rect.width > 0 && rect.height > 0 && 
+                 (rect.x % 2) == 0 && (rect.width % 2) == 0 &&
+                 rect.x + rect.width <= DISPLAY_WIDTH && rect.y + rect.height <= DISPLAY_HEIGHT;
+    
+    // Rows must come in frame order so the base is read in a single pass
+    if (valid && (size_t)rect.y * DISPLAY_ROW_BYTES + rect.x / 2 < framePos) {
+        Serial.println("Delta rectangles are not in row order");
+        return false;
+    }
+    
+    if (!valid) {
+        Serial.printf("Invalid delta rectangle %d,%d %dx%d\n", rect.x, rect.y, rect.width, rect.height);
+        return false;
+    }
+    
+    rowsLeft = rect.height;
+    rowBytesLeft = 0;
+    stage = STAGE_DATA;
+    return true;
+}
+
+bool DeltaPatcher::copyBase(size_t until) {
+    if (until < framePos) {
+        Serial.println("Delta rectangles overlap");
+        return false;
+    }
+    
+    while (framePos < until) {
+        size_t count = min(sizeof(baseBuffer), until - framePos);
+        if (!base->readFrame(framePos, baseBuffer, count)) {
+            Serial.println("Failed to read the cached base frame");
+            return false;
+        }
+        if (!emit(baseBuffer, count)) return false;
+    }
+    return true;
+}
+
+bool DeltaPatcher::emit(const uint8_t* data, size_t length) {
+    crc = frameCrc32(crc, data, length);
+    framePos += length;
+    return output->writeFrame(data, length);
+}
@@ -6,6 +6,20 @@
 ******************************************************************************/
 
 #include "epd7in3f.h"
+#include "metrics.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+
+// Given from the BUSY rising edge, when the controller is idle again
+static SemaphoreHandle_t busySemaphore = nullptr;
+
+static void IRAM_ATTR onBusyIdle() {
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(busySemaphore, &woken);
+    portYIELD_FROM_ISR(woken);
+}
 
 EPD7in3f::EPD7in3f() {
     reset_pin = EPD_RST_PIN;
@@ -16,6 +30,11 @@ EPD7in3f::EPD7in3f() {
     sck_pin = EPD_SCK_PIN;
     width = EPD_WIDTH;
     height = EPD_HEIGHT;
+    refreshing = false;
+    lowPowerWait = false;
+    busReady = false;
+    awake = false;
+    spiClock = EPD_SPI_CLOCK_HZ;
 }
 
 EPD7in3f::~EPD7in3f() {
@@ -40,6 +59,12 @@ void EPD7in3f::spiTransfer(unsigned char data) {
 }
 
 int EPD7in3f::ifInit(void) {
+    // The transaction stays open for the rest of the boot; opening it a
+    // second time would block on the bus lock
+    if (busReady) {
+        return 0;
+    }
+    
     pinMode(cs_pin, OUTPUT);
     pinMode(reset_pin, OUTPUT);
     pinMode(dc_pin, OUTPUT);
@@ -47,12 +72,27 @@ int EPD7in3f::ifInit(void) {
     
     // Initialize SPI with custom pins for ESP32-S2
     SPI.begin(sck_pin, -1, din_pin, cs_pin);  // SCK, MISO, MOSI, CS
-    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+    SPI.beginTransaction(SPISettings(spiClock, MSBFIRST, SPI_MODE0));
+    busReady = true;
     
     return 0;
 }
 
+void EPD7in3f::setSpiClock(uint32_t hz) {
+    spiClock = hz;
+    
+    // Reopen the long-lived transaction with the new clock
+    if (busReady) {
+        SPI.endTransaction();
+        SPI.beginTransaction(SPISettings(spiClock, MSBFIRST, SPI_MODE0));
+    }
+}
+
 int EPD7in3f::init(void) {
+    if (awake) {
+        return 0;
+    }
+    
     if (ifInit() != 0) {
         return -1;
     }
@@ -147,6 +187,7 @@ int EPD7in3f::init(void) {
     sendCommand(0xE6);   // TSSET
     sendData(0x00);
 
+    awake = true;
     return 0;
 }
 
@@ -160,6 +201,11 @@ void EPD7in3f::reset(void) {
 }
 
 void EPD7in3f::sendCommand(unsigned char command) {
+    // The controller ignores commands until a pending refresh has finished
+    if (refreshing) {
+        finishRefresh();
+    }
+    
     digitalWrite(dc_pin, LOW);
     spiTransfer(command);
 }
@@ -169,24 +215,103 @@ void EPD7in3f::sendData(unsigned char data) {
     spiTransfer(data);
 }
 
-void EPD7in3f::busyHigh(void) {
-    while(digitalRead(busy_pin) == 0) {      // LOW: idle, HIGH: busy
-        delayMs(5);
+// Bulk data writes keep DC high and CS low for the whole block and let the
+// SPI peripheral clock the bytes out back to back
+void EPD7in3f::sendDataBlock(const UBYTE *data, UDOUBLE length) {
+    digitalWrite(dc_pin, HIGH);
+    digitalWrite(cs_pin, LOW);
+    SPI.writeBytes(data, length);
+    digitalWrite(cs_pin, HIGH);
+}
+
+void EPD7in3f::sendDataRepeat(unsigned char data, UDOUBLE count) {
+    digitalWrite(dc_pin, HIGH);
+    digitalWrite(cs_pin, LOW);
+    SPI.writePattern(&data, 1, count);
+    digitalWrite(cs_pin, HIGH);
+}
+
+bool EPD7in3f::busyHigh(unsigned long timeoutMs) {
+    // LOW: busy, HIGH: idle
+    if (digitalRead(busy_pin) == HIGH) {
+        return true;
+    }
+    
+    unsigned long start = millis();
+    bool idle = lowPowerWait ? sleepUntilIdle(timeoutMs) : blockUntilIdle(timeoutMs);
+    if (!idle) {
+        Serial.printf("E-paper BUSY timeout after %lu ms\n", millis() - start);
     }
-    delayMs(200);
+    return idle;
+}
+
+bool EPD7in3f::blockUntilIdle(unsigned long timeoutMs) {
+    if (!busySemaphore) {
+        busySemaphore = xSemaphoreCreateBinary();
+    }
+    xSemaphoreTake(busySemaphore, 0);  // Drop an edge left from an earlier wait
+    attachInterrupt(digitalPinToInterrupt(busy_pin), onBusyIdle, RISING);
+    
+    // The edge may have come before the interrupt was armed; otherwise the
+    // task blocks and the core is free for WiFi and the network stack
+    bool idle = digitalRead(busy_pin) == HIGH ||
+                xSemaphoreTake(busySemaphore, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+    
+    detachInterrupt(digitalPinToInterrupt(busy_pin));
+    return idle || digitalRead(busy_pin) == HIGH;
+}
+
+bool EPD7in3f::sleepUntilIdle(unsigned long timeoutMs) {
+    unsigned long start = millis();
+    Serial.flush();
+    
+    gpio_wakeup_enable((gpio_num_t)busy_pin, GPIO_INTR_HIGH_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    
+    // millis() keeps counting through light sleep
+    while (digitalRead(busy_pin) == LOW && millis() - start < timeoutMs) {
+        esp_sleep_enable_timer_wakeup((uint64_t)(timeoutMs - (millis() - start)) * 1000ULL);
+        esp_light_sleep_start();
+    }
+    
+    gpio_wakeup_disable((gpio_num_t)busy_pin);
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+    return digitalRead(busy_pin) == HIGH;
 }
 
 void EPD7in3f::turnOnDisplay(void) {
+    startRefresh();
+    finishRefresh();
+}
+
+void EPD7in3f::startRefresh(void) {
     sendCommand(0x04); // POWER_ON
+    METRIC_START(METRIC_BUSY_POWER_ON);
     busyHigh();
+    METRIC_STOP(METRIC_BUSY_POWER_ON);
 
     sendCommand(0x12); // DISPLAY_REFRESH
     sendData(0x00);
-    busyHigh();
+    METRIC_START(METRIC_BUSY_REFRESH);
+    refreshing = true;
+}
+
+bool EPD7in3f::finishRefresh(void) {
+    if (!refreshing) {
+        return true;
+    }
+    refreshing = false;
+    
+    bool idle = busyHigh();
+    METRIC_STOP(METRIC_BUSY_REFRESH);
 
     sendCommand(0x02); // POWER_OFF
     sendData(0x00);
-    busyHigh();
+    METRIC_START(METRIC_BUSY_POWER_OFF);
+    idle = busyHigh() && idle;
+    METRIC_STOP(METRIC_BUSY_POWER_OFF);
+    return idle;
 }
 
 void EPD7in3f::clear(UBYTE color) {
@@ -195,11 +320,7 @@ void EPD7in3f::clear(UBYTE color) {
     Height = EPD_HEIGHT;
 
     sendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            sendData((color << 4) | color);
-        }
-    }
+    sendDataRepeat((color << 4) | color, (UDOUBLE)Width * Height);
     turnOnDisplay();
 }
 
@@ -209,14 +330,14 @@ void EPD7in3f::display(const UBYTE *image) {
     Height = EPD_HEIGHT;
 
     sendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            sendData(image[i + j * Width]);
-        }
-    }
+    sendDataBlock(image, (UDOUBLE)Width * Height);
     turnOnDisplay();
 }
 
+void EPD7in3f::startFrameTransfer(void) {
+    sendCommand(0x10);
+}
+
 void EPD7in3f::displayPart(const UBYTE *image, UWORD xstart, UWORD ystart, 
                            UWORD image_width, UWORD image_height) {
     UWORD Width, Height;
@@ -226,14 +347,18 @@ void EPD7in3f::displayPart(const UBYTE *image, UWORD xstart, UWORD ystart,
     UWORD image_width_8 = (image_width % 2 == 0)? (image_width / 2 ): (image_width / 2 + 1);
     UWORD xstart_8 = (xstart % 2 == 0)? (xstart / 2 ): (xstart / 2 + 1);
 
+    // Clip the window to the panel so the padding counts cannot underflow
+    UWORD part_end = (xstart_8 + image_width_8 > Width)? Width : xstart_8 + image_width_8;
+    UWORD part_width = (xstart_8 < part_end)? part_end - xstart_8 : 0;
+
     sendCommand(0x10);
     for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            if(i >= xstart_8 && i < xstart_8 + image_width_8 && j >= ystart && j < ystart + image_height) {
-                sendData(image[(i - xstart_8) + (j - ystart) * image_width_8]);
-            } else {
-                sendData(0x11);
-            }
+        if(part_width > 0 && j >= ystart && j < ystart + image_height) {
+            sendDataRepeat(0x11, xstart_8);
+            sendDataBlock(image + (UDOUBLE)(j - ystart) * image_width_8, part_width);
+            sendDataRepeat(0x11, Width - part_end);
+        } else {
+            sendDataRepeat(0x11, Width);
         }
     }
     turnOnDisplay();
@@ -244,32 +369,27 @@ void EPD7in3f::showColorBlocks(void) {
     Width = (EPD_WIDTH % 2 == 0)? (EPD_WIDTH / 2 ): (EPD_WIDTH / 2 + 1);
     Height = EPD_HEIGHT;
 
+    // Eight horizontal bands, one color each
+    const UBYTE colors[8] = {
+        EPD_7IN3F_BLACK, EPD_7IN3F_WHITE, EPD_7IN3F_GREEN, EPD_7IN3F_BLUE,
+        EPD_7IN3F_RED, EPD_7IN3F_YELLOW, EPD_7IN3F_ORANGE, EPD_7IN3F_CLEAN
+    };
+
     sendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            if(j < Height/8) {
-                sendData((EPD_7IN3F_BLACK << 4) | EPD_7IN3F_BLACK);
-            } else if(j < Height/8*2) {
-                sendData((EPD_7IN3F_WHITE << 4) | EPD_7IN3F_WHITE);
-            } else if(j < Height/8*3) {
-                sendData((EPD_7IN3F_GREEN << 4) | EPD_7IN3F_GREEN);
-            } else if(j < Height/8*4) {
-                sendData((EPD_7IN3F_BLUE << 4) | EPD_7IN3F_BLUE);
-            } else if(j < Height/8*5) {
-                sendData((EPD_7IN3F_RED << 4) | EPD_7IN3F_RED);
-            } else if(j < Height/8*6) {
-                sendData((EPD_7IN3F_YELLOW << 4) | EPD_7IN3F_YELLOW);
-            } else if(j < Height/8*7) {
-                sendData((EPD_7IN3F_ORANGE << 4) | EPD_7IN3F_ORANGE);
-            } else {
-                sendData((EPD_7IN3F_CLEAN << 4) | EPD_7IN3F_CLEAN);
-            }
-        }
+    for (UWORD band = 0; band < 8; band++) {
+        UWORD rows = (band < 7)? Height / 8 : Height - (Height / 8) * 7;
+        sendDataRepeat((colors[band] << 4) | colors[band], (UDOUBLE)Width * rows);
     }
     turnOnDisplay();
 }
 
 void EPD7in3f::sleep(void) {
+    if (!awake) {
+        return;
+    }
+    
+    // Waits for a pending refresh first; only a reset wakes the panel again
     sendCommand(0x07); // DEEP_SLEEP
     sendData(0xA5);
+    awake = false;
 }
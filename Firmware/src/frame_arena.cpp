@@ -0,0 +1,69 @@
+#include "frame_arena.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+FrameArena::FrameArena() : memory(nullptr), slotCount(0), inPsram(false) {
+    for (int i = 0; i < FRAME_ARENA_SLOTS; i++) {
+        owners[i] = nullptr;
+    }
+}
+
+FrameArena::~FrameArena() {
+    if (memory) {
+        heap_caps_free(memory);
+    }
+}
+
+bool FrameArena::begin() {
+    if (memory) return true;
+    
+    memory = (uint8_t*)heap_caps_malloc((size_t)DISPLAY_FRAME_SIZE * FRAME_ARENA_SLOTS, 
+                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (memory) {
+        slotCount = FRAME_ARENA_SLOTS;
+        inPsram = true;
+    } else {
+        memory = (uint8_t*)heap_caps_malloc(DISPLAY_FRAME_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        slotCount = memory ? 1 : 0;
+    }
+    
+    if (!memory) {
+        Serial.println("Failed to reserve a frame buffer - screens needing one are disabled");
+        return false;
+    }
+    
+    Serial.printf("Frame arena: %d x %d bytes in %s\n", slotCount, DISPLAY_FRAME_SIZE, 
+                  inPsram ? "PSRAM" : "internal RAM");
+    return true;
+}
+
+uint8_t* FrameArena::acquire(const char* owner) {
+    for (int i = 0; i < slotCount; i++) {
+        if (!owners[i]) {
+            owners[i] = owner;
+            return memory + (size_t)i * DISPLAY_FRAME_SIZE;
+        }
+    }
+    
+    Serial.printf("No free frame buffer for %s (held by %s)\n", owner, 
+                  slotCount > 0 ? owners[0] : "nobody - arena not allocated");
+    return nullptr;
+}
+
+void FrameArena::release(uint8_t* buffer) {
+    for (int i = 0; i < slotCount; i++) {
+        if (buffer == memory + (size_t)i * DISPLAY_FRAME_SIZE) {
+            owners[i] = nullptr;
+            return;
+        }
+    }
+}
+
+int FrameArena::getFreeSlots() const {
+    int count = 0;
+    for (int i = 0; i < slotCount; i++) {
+        if (!owners[i]) count++;
+    }
+    return count;
+}
@@ -0,0 +1,330 @@
+#include "frame_decoder.h"
+#include "config.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+// The ROM ships miniz's inflater, so zlib frames cost no extra flash
+#if CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/miniz.h"
+#elif CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#else
+#include "esp32/rom/miniz.h"
+#endif
+
+// tinfl decodes into a power-of-two ring buffer that doubles as the LZ77 window
+struct InflateState {
+    tinfl_decompressor inflator;
+    uint8_t window[FRAME_INFLATE_WINDOW];
+};
+
+// Chunks at least this large skip the staging buffer
+#define FRAME_DIRECT_WRITE_MIN 256
+
+FrameDecoder::FrameDecoder() : 
+    frameOutput(nullptr), deltaOutput(nullptr), trueColorOutput(nullptr), output(nullptr), 
+    frameWidth(DISPLAY_WIDTH), frameHeight(DISPLAY_HEIGHT), mode(MODE_HEADER), streamSize(0), headerBytes(0), payloadRead(0), 
+    decodedBytes(0), crc(0), outputStarted(false), zlibDone(false), rleRemaining(0), 
+    rleExpectValue(false), inflate(nullptr), windowPos(0), outLength(0) {
+    memset(&header, 0, sizeof(header));
+}
+
+FrameDecoder::~FrameDecoder() {
+    releaseInflate();
+}
+
+bool FrameDecoder::beginFrame(size_t frameSize) {
+    output = frameOutput;
+    if (!output) return false;
+    
+    memset(&header, 0, sizeof(header));
+    mode = MODE_HEADER;
+    streamSize = frameSize;
+    headerBytes = 0;
+    payloadRead = 0;
+    decodedBytes = 0;
+    crc = 0;
+    outputStarted = false;
+    zlibDone = false;
+    rleRemaining = 0;
+    rleExpectValue = false;
+    windowPos = 0;
+    outLength = 0;
+    return true;
+}
+
+bool FrameDecoder::writeFrame(const uint8_t* data, size_t length) {
+    if (mode == MODE_ERROR) return false;
+    
+    if (mode == MODE_HEADER) {
+        size_t take = min(length, (size_t)FRAME_HEADER_SIZE - headerBytes);
+        memcpy((uint8_t*)&header + headerBytes, data, take);
+        headerBytes += take;
+        data += take;
+        length -= take;
+        
+        // Legacy raw frames are recognised as soon as the magic cannot match
+        if (headerBytes >= sizeof(header.magic) && header.magic != FRAME_MAGIC) {
+            if (!startPassthrough()) {
+                mode = MODE_ERROR;
+                return false;
+            }
+        } else if (headerBytes < FRAME_HEADER_SIZE) {
+            return true;
+        } else if (!parseHeader()) {
+            mode = MODE_ERROR;
+            return false;
+        }
+    }
+    
+    if (length == 0) return true;
+    
+    if (mode == MODE_PASSTHROUGH) {
+        return output->writeFrame(data, length);
+    }
+    
+    if (!decodePayload(data, length)) {
+        mode = MODE_ERROR;
+        return false;
+    }
+    return true;
+}
+
+bool FrameDecoder::endFrame(bool commit) {
+    bool complete = commit;
+    
+    if (mode == MODE_ERROR || mode == MODE_HEADER) {
+        complete = false;
+    } else if (mode != MODE_PASSTHROUGH) {
+        if (!flushOutput()) {
+            complete = false;
+        }
+        
+        bool intact = decodedBytes == header.rawSize && crc == header.crc32 && 
+                      (mode != MODE_ZLIB || zlibDone);
+        if (commit && !intact) {
+            Serial.printf("Frame integrity check failed: %u/%lu bytes, CRC %08X (expected %08X)\n",
+                          (unsigned)decodedBytes, (unsigned long)header.rawSize, crc, header.crc32);
+        }
+        complete = complete && intact;
+    }
+    
+    if (!outputStarted) return false;
+    outputStarted = false;
+    
+    return output->endFrame(complete);
+}
+
+bool FrameDecoder::parseHeader() {
+    if (header.version != FRAME_VERSION || header.pixelFormat != FRAME_PIXEL_4BPP) {
+        Serial.printf("Unsupported frame container v%d (format %d)\n", header.version, header.pixelFormat);
+        return false;
+    }
+    
+    bool delta = header.flags & FRAME_FLAG_DELTA;
+    if (delta) {
+        if (!deltaOutput) {
+            Serial.println("Delta frame received but no delta sink is configured");
+            return false;
+        }
+        output = deltaOutput;
+    }
+    
+    // A delta payload is a patch list, so only a full frame has a fixed size
+    if (header.width != frameWidth || header.height != frameHeight ||
+        (delta ? header.rawSize < FRAME_DELTA_HEADER_SIZE 
+               : header.rawSize != (uint32_t)header.width * header.height / 2)) {
+        Serial.printf("Frame geometry %dx%d (%d bytes) does not match the display\n",
+                      header.width, header.height, header.rawSize);
+        return false;
+    }
+    
+    if (header.payloadSize + FRAME_HEADER_SIZE > streamSize) {
+        Serial.printf("Frame payload (%d bytes) exceeds the download size\n", header.payloadSize);
+        return false;
+    }
+    
+    switch (header.codec) {
+        case FRAME_CODEC_RAW:
+            mode = MODE_RAW;
+            break;
+        case FRAME_CODEC_RLE:
+            mode = MODE_RLE;
+            break;
+        case FRAME_CODEC_ZLIB:
+            // Allocated on the first zlib frame and kept for the next ones
+            if (!inflate) {
+                inflate = (InflateState*)malloc(sizeof(InflateState));
+            }
+            if (!inflate) {
+                Serial.printf("Failed to allocate %u bytes for the inflater\n", (unsigned)sizeof(InflateState));
+                return false;
+            }
+            tinfl_init(&inflate->inflator);
+            mode = MODE_ZLIB;
+            break;
+        default:
+            Serial.printf("Unknown frame codec: %d\n", header.codec);
+            return false;
+    }
+    
+    Serial.printf("Frame container: %s, codec %d, %d -> %d bytes\n", delta ? "delta" : "full",
+                  header.codec, header.payloadSize, header.rawSize);
+    
+    if (!output->beginFrame(header.rawSize)) {
+        return false;
+    }
+    outputStarted = true;
+    return true;
+}
+
+bool FrameDecoder::startPassthrough() {
+    mode = MODE_PASSTHROUGH;
+    
+    // The quantizer only takes whole panel images, never tiles
+    size_t pixels = (size_t)DISPLAY_WIDTH * DISPLAY_HEIGHT;
+    if (trueColorOutput && (streamSize == pixels * 3 || streamSize == pixels * 2)) {
+        output = trueColorOutput;
+    }
+    
+    if (!output->beginFrame(streamSize)) {
+        return false;
+    }
+    outputStarted = true;
+    
+    // Replay the bytes consumed while looking for the header
+    return output->writeFrame((const uint8_t*)&header, headerBytes);
+}
+
+bool FrameDecoder::decodePayload(const uint8_t* data, size_t length) {
+    // Trailing bytes after the declared payload are ignored
+    size_t remaining = header.payloadSize - payloadRead;
+    if (length > remaining) {
+        length = remaining;
+    }
+    payloadRead += length;
+    
+    switch (mode) {
+        case MODE_RAW:
+            return emit(data, length);
+        case MODE_RLE:
+            return decodeRle(data, length);
+        case MODE_ZLIB:
+            return decodeZlib(data, length);
+        default:
+            return false;
+    }
+}
+
+bool FrameDecoder::decodeRle(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        if (rleExpectValue) {
+            if (!emitRepeat(*data, rleRemaining)) return false;
+            rleRemaining = 0;
+            rleExpectValue = false;
+            data++;
+            length--;
+        } else if (rleRemaining > 0) {
+            size_t count = min(rleRemaining, length);
+            if (!emit(data, count)) return false;
+            rleRemaining -= count;
+            data += count;
+            length -= count;
+        } else {
+            uint8_t control = *data++;
+            length--;
+            if (control < 0x80) {
+                rleRemaining = control + 1;
+            } else {
+                rleRemaining = (control & 0x7F) + FRAME_RLE_MIN_RUN;
+                rleExpectValue = true;
+            }
+        }
+    }
+    return true;
+}
+
+bool FrameDecoder::decodeZlib(const uint8_t* data, size_t length) {
+    while (!zlibDone) {
+        size_t inBytes = length;
+        size_t outBytes = FRAME_INFLATE_WINDOW - windowPos;
+        mz_uint32 flags = TINFL_FLAG_PARSE_ZLIB_HEADER;
+        if (payloadRead < header.payloadSize) {
+            flags |= TINFL_FLAG_HAS_MORE_INPUT;
+        }
+        
+        tinfl_status status = tinfl_decompress(&inflate->inflator, data, &inBytes, 
+                                               inflate->window, inflate->window + windowPos, 
+                                               &outBytes, flags);
+        data += inBytes;
+        length -= inBytes;
+        
+        if (outBytes > 0 && !emit(inflate->window + windowPos, outBytes)) {
+            return false;
+        }
+        windowPos = (windowPos + outBytes) & (FRAME_INFLATE_WINDOW - 1);
+        
+        if (status == TINFL_STATUS_DONE) {
+            zlibDone = true;
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT) {
+            if (length == 0) break;
+        } else if (status != TINFL_STATUS_HAS_MORE_OUTPUT) {
+            Serial.printf("Inflate failed with status %d\n", status);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FrameDecoder::emit(const uint8_t* data, size_t length) {
+    if (length > header.rawSize - decodedBytes) {
+        Serial.println("Frame payload decodes past the declared size");
+        return false;
+    }
+    
+    crc = frameCrc32(crc, data, length);
+    decodedBytes += length;
+    
+    if (length >= FRAME_DIRECT_WRITE_MIN) {
+        return flushOutput() && output->writeFrame(data, length);
+    }
+    
+    while (length > 0) {
+        size_t count = min(length, sizeof(outBuffer) - outLength);
+        memcpy(outBuffer + outLength, data, count);
+        outLength += count;
+        data += count;
+        length -= count;
+        
+        if (outLength == sizeof(outBuffer) && !flushOutput()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FrameDecoder::emitRepeat(uint8_t value, size_t count) {
+    while (count > 0) {
+        uint8_t run[32];
+        size_t chunk = min(count, sizeof(run));
+        memset(run, value, chunk);
+        if (!emit(run, chunk)) return false;
+        count -= chunk;
+    }
+    return true;
+}
+
+bool FrameDecoder::flushOutput() {
+    if (outLength == 0) return true;
+    
+    bool ok = output->writeFrame(outBuffer, outLength);
+    outLength = 0;
+    return ok;
+}
+
+void FrameDecoder::releaseInflate() {
+    if (inflate) {
+        free(inflate);
+        inflate = nullptr;
+    }
+}
@@ -0,0 +1,178 @@
+#include "frame_pipeline.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+#define PIPELINE_FLUSH_MARKER 0xFF  // Queued after the last chunk of a frame
+
+FramePipeline::FramePipeline() : 
+    output(nullptr), freeQueue(nullptr), filledQueue(nullptr), drained(nullptr), 
+    task(nullptr), current(nullptr), currentIndex(0), failed(false), markerQueued(false), stalled(false) {
+}
+
+FramePipeline::~FramePipeline() {
+    if (task) vTaskDelete(task);
+    if (freeQueue) vQueueDelete(freeQueue);
+    if (filledQueue) vQueueDelete(filledQueue);
+    if (drained) vSemaphoreDelete(drained);
+}
+
+bool FramePipeline::begin() {
+    if (task) return true;
+    
+    freeQueue = xQueueCreate(PIPELINE_CHUNK_COUNT, sizeof(uint8_t));
+    filledQueue = xQueueCreate(PIPELINE_CHUNK_COUNT + 1, sizeof(uint8_t));  // + flush marker
+    drained = xSemaphoreCreateBinary();
+    
+    if (!freeQueue || !filledQueue || !drained) {
+        Serial.println("Failed to create frame pipeline queues - uploading synchronously");
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < PIPELINE_CHUNK_COUNT; i++) {
+        xQueueSend(freeQueue, &i, 0);
+    }
+    
+    if (xTaskCreate(taskEntry, "display", PIPELINE_TASK_STACK, this, 
+                    PIPELINE_TASK_PRIORITY, &task) != pdPASS) {
+        task = nullptr;
+        Serial.println("Failed to start display task - uploading synchronously");
+        return false;
+    }
+    
+    return true;
+}
+
+bool FramePipeline::beginFrame(size_t frameSize) {
+    if (!output) return false;
+    
+    // The display task is idle between frames, so the output can be
+    // started from this task - after a stall, only once it has caught up
+    if (!quiesce()) {
+        Serial.println("Display task still busy - skipping frame");
+        return false;
+    }
+    xSemaphoreTake(drained, 0);
+    
+    failed = false;
+    current = nullptr;
+    return output->beginFrame(frameSize);
+}
+
+bool FramePipeline::writeFrame(const uint8_t* data, size_t length) {
+    if (!task) return output->writeFrame(data, length);
+    
+    while (length > 0) {
+        if (failed) return false;
+        
+        if (!current) {
+            if (xQueueReceive(freeQueue, &currentIndex, pdMS_TO_TICKS(PIPELINE_STALL_TIMEOUT_MS)) != pdTRUE) {
+                Serial.println("Display task stalled - aborting frame");
+                return false;
+            }
+            current = &chunks[currentIndex];
+            current->length = 0;
+        }
+        
+        size_t n = PIPELINE_CHUNK_SIZE - current->length;
+        if (n > length) n = length;
+        memcpy(current->data + current->length, data, n);
+        current->length += n;
+        data += n;
+        length -= n;
+        
+        if (current->length == PIPELINE_CHUNK_SIZE && !pushCurrent()) {
+            return false;
+        }
+    }
+    
+    return !failed;
+}
+
+bool FramePipeline::endFrame(bool commit) {
+    if (!output) return false;
+    
+    // Everything queued must reach the panel RAM before the refresh starts;
+    // the output cannot be touched while the display task may still write
+    if (task && !drain()) {
+        stalled = true;
+        return false;
+    }
+    return output->endFrame(commit && !failed);
+}
+
+bool FramePipeline::quiesce() {
+    if (!stalled) return true;
+    
+    if (!waitIdle()) return false;
+    stalled = false;
+    output->endFrame(false);
+    return true;
+}
+
+bool FramePipeline::pushCurrent() {
+    if (!current) return true;
+    
+    current = nullptr;
+    if (xQueueSend(filledQueue, &currentIndex, pdMS_TO_TICKS(PIPELINE_STALL_TIMEOUT_MS)) != pdTRUE) {
+        // Keep the chunk in circulation for the next frame
+        xQueueSend(freeQueue, &currentIndex, 0);
+        return false;
+    }
+    return true;
+}
+
+bool FramePipeline::drain() {
+    if (current && current->length > 0) {
+        if (!pushCurrent()) return false;
+    } else if (current) {
+        // Nothing was written into it - hand it straight back
+        current = nullptr;
+        xQueueSend(freeQueue, &currentIndex, 0);
+    }
+    
+    if (!waitIdle()) {
+        Serial.println("Display task did not drain the frame queue");
+        return false;
+    }
+    return true;
+}
+
+bool FramePipeline::waitIdle() {
+    // A marker queued by a drain that timed out is still the one to wait for
+    if (!markerQueued) {
+        uint8_t marker = PIPELINE_FLUSH_MARKER;
+        if (xQueueSend(filledQueue, &marker, pdMS_TO_TICKS(PIPELINE_STALL_TIMEOUT_MS)) != pdTRUE) {
+            return false;
+        }
+        markerQueued = true;
+    }
+    
+    if (xSemaphoreTake(drained, pdMS_TO_TICKS(PIPELINE_STALL_TIMEOUT_MS)) != pdTRUE) {
+        return false;
+    }
+    markerQueued = false;
+    return true;
+}
+
+void FramePipeline::taskEntry(void* arg) {
+    static_cast<FramePipeline*>(arg)->consume();
+}
+
+void FramePipeline::consume() {
+    for (;;) {
+        uint8_t index;
+        if (xQueueReceive(filledQueue, &index, portMAX_DELAY) != pdTRUE) continue;
+        
+        if (index == PIPELINE_FLUSH_MARKER) {
+            xSemaphoreGive(drained);
+            continue;
+        }
+        
+        // After a rejected write the rest of the frame is only recycled
+        Chunk& chunk = chunks[index];
+        if (!failed && !output->writeFrame(chunk.data, chunk.length)) {
+            failed = true;
+        }
+        xQueueSend(freeQueue, &index, portMAX_DELAY);
+    }
+}
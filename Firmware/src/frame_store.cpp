@@ -0,0 +1,383 @@
+#include "frame_store.h"
+#include "config.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+#include <LittleFS.h>
+
+static const char* const SLOT_PATHS[] = {
+    "/frame0.epf", "/frame1.epf", "/frame2.epf", "/frame3.epf",
+    "/frame4.epf", "/frame5.epf", "/frame6.epf", "/frame7.epf"
+};
+static_assert(FRAME_STORE_SLOT_COUNT <= sizeof(SLOT_PATHS) / sizeof(SLOT_PATHS[0]), "Add slot paths");
+
+FrameStore::FrameStore() : 
+    output(nullptr), mounted(false), view(0), sequence(0), readerOffset(0), 
+    recording(false), recordSlot(-1), recordSize(0), recordedBytes(0), recordCrc(0) {
+    for (int i = 0; i < FRAME_STORE_MAX_VIEWS; i++) {
+        viewSlot[i] = -1;
+        previousSlot[i] = -1;
+        viewCrc[i] = 0;
+    }
+}
+
+bool FrameStore::begin(bool verify) {
+    if (!mounted) {
+        // First boot on a blank partition formats it
+        if (!LittleFS.begin(true)) {
+            Serial.println("Failed to mount LittleFS - frame cache disabled");
+            return false;
+        }
+        mounted = true;
+    }
+    
+    closeReader();
+    for (int i = 0; i < FRAME_STORE_MAX_VIEWS; i++) {
+        viewSlot[i] = -1;
+        previousSlot[i] = -1;
+        viewCrc[i] = 0;
+    }
+    
+    StoreIndex index;
+    if (!readIndex(index)) {
+        Serial.println("No cached frame");
+        return true;
+    }
+    sequence = index.sequence;
+    
+    bool changed = false;
+    int cached = 0;
+    for (int v = 0; v < FRAME_STORE_MAX_VIEWS; v++) {
+        // The previous slot holds the frame before it, which is still better than nothing
+        int candidates[2] = { index.slot[v], index.previous[v] };
+        for (int attempt = 0; attempt < 2; attempt++) {
+            int slot = candidates[attempt];
+            if (slot < 0 || slot >= FRAME_STORE_SLOT_COUNT) continue;
+            FrameHeader header;
+            if (!readSlotHeader(slot, header)) continue;
+            if (attempt == 0 && header.crc32 != index.crc[v]) continue;
+            if (verify && !verifySlot(slot, header.crc32)) continue;
+            
+            viewSlot[v] = slot;
+            viewCrc[v] = header.crc32;
+            previousSlot[v] = attempt == 0 ? index.previous[v] : -1;
+            break;
+        }
+        
+        if (viewSlot[v] != index.slot[v]) {
+            changed = true;
+        }
+        if (viewSlot[v] >= 0) {
+            cached++;
+            Serial.printf("Cached frame for view %d in slot %d (CRC %08X%s)\n", 
+                          v, viewSlot[v], viewCrc[v], verify ? ", verified" : "");
+        }
+    }
+    
+    if (cached == 0) {
+        Serial.println("Cached frames failed verification - discarding them");
+        LittleFS.remove(FRAME_STORE_INDEX_PATH);
+    } else if (changed) {
+        writeIndex();
+    }
+    return true;
+}
+
+bool FrameStore::selectView(int newView) {
+    if (newView < 0 || newView >= FRAME_STORE_MAX_VIEWS || recording) {
+        return false;
+    }
+    if (newView != view) {
+        closeReader();
+        view = newView;
+    }
+    return true;
+}
+
+const char* FrameStore::slotPath(int slot) {
+    return SLOT_PATHS[slot];
+}
+
+bool FrameStore::readIndex(StoreIndex& index) {
+    File file = LittleFS.open(FRAME_STORE_INDEX_PATH, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    
+    union {
+        StoreIndex current;
+        LegacyIndex legacy;
+    } data;
+    memset(&data, 0, sizeof(data));
+    size_t length = file.read((uint8_t*)&data, sizeof(data));
+    file.close();
+    
+    if (length == sizeof(StoreIndex) && data.current.magic == FRAME_STORE_INDEX_MAGIC) {
+        index = data.current;
+        return true;
+    }
+    
+    // Written before playlists: one view alternating between the first two slots
+    if (length == sizeof(LegacyIndex) && data.legacy.magic == FRAME_STORE_LEGACY_INDEX_MAGIC &&
+        data.legacy.slot < 2) {
+        memset(&index, 0, sizeof(index));
+        index.magic = FRAME_STORE_INDEX_MAGIC;
+        index.sequence = data.legacy.sequence;
+        for (int v = 0; v < FRAME_STORE_MAX_VIEWS; v++) {
+            index.slot[v] = -1;
+            index.previous[v] = -1;
+        }
+        index.slot[0] = data.legacy.slot;
+        index.previous[0] = 1 - data.legacy.slot;
+        index.crc[0] = data.legacy.crc;
+        return true;
+    }
+    return false;
+}
+
+bool FrameStore::readSlotHeader(int slot, FrameHeader& header) {
+    File file = LittleFS.open(slotPath(slot), FILE_READ);
+    if (!file) {
+        return false;
+    }
+    
+    bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                 header.magic == FRAME_MAGIC && header.codec == FRAME_CODEC_RAW &&
+                 header.rawSize == DISPLAY_FRAME_SIZE &&
+                 file.size() == FRAME_HEADER_SIZE + DISPLAY_FRAME_SIZE;
+    file.close();
+    return valid;
+}
+
+bool FrameStore::verifySlot(int slot, uint32_t crc) {
+    File file = LittleFS.open(slotPath(slot), FILE_READ);
+    if (!file || !file.seek(FRAME_HEADER_SIZE)) {
+        return false;
+    }
+    
+    uint8_t buffer[FRAME_STORE_READ_CHUNK];
+    uint32_t actual = 0;
+    size_t total = 0;
+    while (total < DISPLAY_FRAME_SIZE) {
+        int bytesRead = file.read(buffer, min(sizeof(buffer), (size_t)DISPLAY_FRAME_SIZE - total));
+        if (bytesRead <= 0) break;
+        actual = frameCrc32(actual, buffer, bytesRead);
+        total += bytesRead;
+    }
+    file.close();
+    
+    if (total != DISPLAY_FRAME_SIZE || actual != crc) {
+        Serial.printf("Slot %d CRC mismatch (%08X, expected %08X)\n", slot, actual, crc);
+        return false;
+    }
+    return true;
+}
+
+bool FrameStore::writeIndex() {
+    StoreIndex index;
+    index.magic = FRAME_STORE_INDEX_MAGIC;
+    index.sequence = ++sequence;
+    for (int v = 0; v < FRAME_STORE_MAX_VIEWS; v++) {
+        index.slot[v] = viewSlot[v];
+        index.previous[v] = previousSlot[v];
+        index.crc[v] = viewCrc[v];
+    }
+    
+    // LittleFS commits small files atomically, so this is the swap point
+    File file = LittleFS.open(FRAME_STORE_INDEX_PATH, FILE_WRITE);
+    if (!file) {
+        return false;
+    }
+    bool written = file.write((const uint8_t*)&index, sizeof(index)) == sizeof(index);
+    file.close();
+    return written;
+}
+
+int FrameStore::pickRecordSlot() const {
+    // Never a slot a view shows; prefer one that holds no fallback frame,
+    // then this view's own fallback, so other views keep theirs
+    int fallback = -1;
+    for (int slot = 0; slot < FRAME_STORE_SLOT_COUNT; slot++) {
+        bool active = false;
+        bool previous = false;
+        for (int v = 0; v < FRAME_STORE_MAX_VIEWS; v++) {
+            active |= viewSlot[v] == slot;
+            previous |= previousSlot[v] == slot;
+        }
+        if (active) continue;
+        if (!previous) return slot;
+        if (fallback < 0 || slot == previousSlot[view]) {
+            fallback = slot;
+        }
+    }
+    return fallback;
+}
+
+bool FrameStore::readFrame(size_t offset, uint8_t* buffer, size_t length) {
+    int activeSlot = viewSlot[view];
+    if (activeSlot < 0 || offset + length > DISPLAY_FRAME_SIZE) {
+        return false;
+    }
+    
+    if (!reader) {
+        reader = LittleFS.open(slotPath(activeSlot), FILE_READ);
+        if (!reader) return false;
+        readerOffset = (size_t)-1;
+    }
+    
+    if (readerOffset != offset) {
+        if (!reader.seek(FRAME_HEADER_SIZE + offset)) return false;
+        readerOffset = offset;
+    }
+    
+    size_t bytesRead = reader.read(buffer, length);
+    readerOffset += bytesRead;
+    return bytesRead == length;
+}
+
+void FrameStore::closeReader() {
+    if (reader) {
+        reader.close();
+    }
+}
+
+bool FrameStore::replay(FrameSink* sink) {
+    if (viewSlot[view] < 0 || !sink) {
+        return false;
+    }
+    
+    Serial.printf("Redrawing cached frame for view %d from slot %d\n", view, viewSlot[view]);
+    if (!sink->beginFrame(DISPLAY_FRAME_SIZE)) {
+        return false;
+    }
+    
+    uint8_t buffer[FRAME_STORE_READ_CHUNK];
+    uint32_t crc = 0;
+    size_t offset = 0;
+    bool ok = true;
+    while (ok && offset < DISPLAY_FRAME_SIZE) {
+        size_t count = min(sizeof(buffer), (size_t)DISPLAY_FRAME_SIZE - offset);
+        ok = readFrame(offset, buffer, count) && sink->writeFrame(buffer, count);
+        crc = frameCrc32(crc, buffer, count);
+        offset += count;
+    }
+    closeReader();
+    
+    if (ok && crc != viewCrc[view]) {
+        Serial.printf("Cached frame CRC mismatch (%08X, expected %08X)\n", crc, viewCrc[view]);
+        ok = false;
+    }
+    return sink->endFrame(ok) && ok;
+}
+
+bool FrameStore::beginFrame(size_t frameSize) {
+    if (!output || !output->beginFrame(frameSize)) {
+        return false;
+    }
+    
+    // Recording is best effort - a flash problem must never block the display
+    recording = false;
+    if (mounted && frameSize == DISPLAY_FRAME_SIZE) {
+        recordSlot = pickRecordSlot();
+        
+        // Forget fallbacks about to be overwritten before truncating them,
+        // so a reset mid-download never falls back to another view's frame
+        bool dropped = false;
+        for (int v = 0; v < FRAME_STORE_MAX_VIEWS; v++) {
+            if (previousSlot[v] == recordSlot) {
+                previousSlot[v] = -1;
+                dropped = true;
+            }
+        }
+        if (dropped && !writeIndex()) {
+            Serial.println("Failed to update frame index");
+        }
+        
+        writer = LittleFS.open(slotPath(recordSlot), FILE_WRITE);
+        if (writer) {
+            // Zeroed header until the frame is complete, so a torn slot never validates
+            FrameHeader header;
+            memset(&header, 0, sizeof(header));
+            recording = writer.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+            recordSize = frameSize;
+            recordedBytes = 0;
+            recordCrc = 0;
+        }
+        if (!recording) {
+            Serial.println("Could not record frame to flash");
+            stopRecording();
+        }
+    }
+    return true;
+}
+
+bool FrameStore::writeFrame(const uint8_t* data, size_t length) {
+    if (!output->writeFrame(data, length)) {
+        return false;
+    }
+    
+    if (recording) {
+        size_t count = min(length, recordSize - recordedBytes);
+        if (writer.write(data, count) != count) {
+            Serial.println("Flash write failed - frame will not be cached");
+            stopRecording();
+        } else {
+            recordCrc = frameCrc32(recordCrc, data, count);
+            recordedBytes += count;
+        }
+    }
+    return true;
+}
+
+bool FrameStore::endFrame(bool commit) {
+    bool shown = output->endFrame(commit);
+    
+    if (!recording) {
+        return shown;
+    }
+    
+    if (!shown || !commit || recordedBytes != recordSize) {
+        stopRecording();
+        return shown;
+    }
+    
+    FrameHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = FRAME_MAGIC;
+    header.version = FRAME_VERSION;
+    header.codec = FRAME_CODEC_RAW;
+    header.pixelFormat = FRAME_PIXEL_4BPP;
+    header.width = DISPLAY_WIDTH;
+    header.height = DISPLAY_HEIGHT;
+    header.rawSize = recordSize;
+    header.payloadSize = recordSize;
+    header.crc32 = recordCrc;
+    
+    bool written = writer.seek(0) && 
+                   writer.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    writer.close();
+    recording = false;
+    
+    closeReader();
+    int8_t oldSlot = viewSlot[view];
+    int8_t oldPrevious = previousSlot[view];
+    uint32_t oldCrc = viewCrc[view];
+    viewSlot[view] = recordSlot;
+    previousSlot[view] = oldSlot;
+    viewCrc[view] = recordCrc;
+    if (written && writeIndex()) {
+        Serial.printf("Frame for view %d cached to slot %d (CRC %08X)\n", view, recordSlot, recordCrc);
+    } else {
+        viewSlot[view] = oldSlot;
+        previousSlot[view] = oldPrevious;
+        viewCrc[view] = oldCrc;
+        Serial.println("Failed to cache frame to flash - keeping the previous slot");
+    }
+    return shown;
+}
+
+void FrameStore::stopRecording() {
+    if (writer) {
+        writer.close();
+    }
+    recording = false;
+}
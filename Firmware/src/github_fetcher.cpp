@@ -1,37 +1,50 @@
 #include "github_fetcher.h"
 #include "config.h"
+#include "rtc_state.h"
+#include "metrics.h"
+#include "logger.h"
 #include "serial_config.h"  // Must be included before Arduino.h
 #include <Arduino.h>
 
 GitHubImageFetcher::GitHubImageFetcher(ConfigManager* configMgr) : 
-    configManager(configMgr), imageBuffer(nullptr), bufferSize(0), bufferAllocated(false) {
+    configManager(configMgr), frameArena(nullptr), imageBuffer(nullptr), bufferSize(0), bufferAllocated(false), 
+    frameStore(nullptr), tileCache(nullptr), view(0), lastHttpCode(0), lastRetryAfter(0), downloadLimit(MAX_IMAGE_SIZE), lastETagUrlHash(0), etagLoaded(false) {
     
     // Configure SSL client to skip certificate verification for GitHub
     client.setInsecure();
+    
+    // Keep the TLS connection open between requests so the .epf -> .bin
+    // fallback and any follow-up fetches skip the handshake
+    http.setReuse(true);
+    
+    frameDecoder.setDeltaOutput(&deltaPatcher);
+    frameDecoder.setTrueColorOutput(&colorQuantizer);
+    tileAssembler.setDecoder(&frameDecoder);
 }
 
 GitHubImageFetcher::~GitHubImageFetcher() {
+    endSession();
     freeBuffer();
 }
 
 bool GitHubImageFetcher::fetchLatestImage() {
     if (!configManager || !configManager->isConfigured()) {
-        Serial.println("Cannot fetch image: configuration not available");
+        LOGE("Cannot fetch image: configuration not available");
         return false;
     }
     
     if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("Cannot fetch image: WiFi not connected");
+        LOGE("Cannot fetch image: WiFi not connected");
         return false;
     }
     
-    String imageURL = buildImageURL();
-    if (imageURL.length() == 0) {
-        Serial.println("Cannot fetch image: invalid URL");
+    char imageURL[MAX_URL_LENGTH];
+    if (!buildImageURL(imageURL)) {
+        LOGE("Cannot fetch image: invalid URL");
         return false;
     }
     
-    Serial.printf("Fetching image from: %s\n", imageURL.c_str());
+    LOGI("Fetching image from: %s", imageURL);
     
     // Free previous buffer if exists
     freeBuffer();
@@ -39,31 +52,270 @@ bool GitHubImageFetcher::fetchLatestImage() {
     return downloadImage(imageURL, imageBuffer, bufferSize);
 }
 
-String GitHubImageFetcher::buildImageURL() {
+void GitHubImageFetcher::setFrameStore(FrameStore* store) {
+    frameStore = store;
+    deltaPatcher.setBase(store);
+}
+
+void GitHubImageFetcher::setTileCache(TileCache* cache) {
+    tileCache = cache;
+    tileAssembler.setCache(cache);
+}
+
+bool GitHubImageFetcher::buildImageURL(char* url, const char* extension, const char* variant) {
     if (!configManager || !configManager->isConfigured()) {
-        return "";
+        url[0] = '\0';
+        return false;
+    }
+    
+    // The view URL already has the PNG/binary extension stripped
+    int length = snprintf(url, MAX_URL_LENGTH, "%s%s%s", configManager->getViewURL(view), variant, extension);
+    return length > 0 && length < (int)MAX_URL_LENGTH;
+}
+
+bool GitHubImageFetcher::buildRepoURL(char* url, const char* path) {
+    if (!configManager || !configManager->isConfigured()) {
+        url[0] = '\0';
+        return false;
+    }
+    
+    int length = snprintf(url, MAX_URL_LENGTH, "%s%s", configManager->getRepoURL(), path);
+    return length > 0 && length < (int)MAX_URL_LENGTH;
+}
+
+bool GitHubImageFetcher::fetchRepoJson(const char* path, JsonDocument& doc) {
+    char url[MAX_URL_LENGTH];
+    if (!buildRepoURL(url, path) || WiFi.status() != WL_CONNECTED) {
+        return false;
     }
     
-    // GitHub raw URL format: https://raw.githubusercontent.com/owner/repo/branch/path
-    String url = "https://raw.githubusercontent.com/";
-    url += configManager->getGitHubRepo();
-    url += "/main/";  // Assuming main branch
+    LOGI("Fetching %s", url);
+    return fetchJson(url, doc);
+}
+
+bool GitHubImageFetcher::streamRepoFile(const char* path, FrameSink* sink, size_t maxSize) {
+    char url[MAX_URL_LENGTH];
+    if (!sink || !buildRepoURL(url, path) || WiFi.status() != WL_CONNECTED) {
+        return false;
+    }
     
-    // Convert PNG path to binary e-paper format path
-    String imagePath = configManager->getGitHubImagePath();
-    if (imagePath.endsWith(".png")) {
-        imagePath = imagePath.substring(0, imagePath.length() - 4) + ".bin";
-    } else if (!imagePath.endsWith(".bin")) {
-        imagePath += ".bin";
+    // The fetcher's own downloads stay capped at one frame
+    size_t size = 0;
+    downloadLimit = maxSize;
+    int httpCode = beginDownload(url, size, false);
+    if (httpCode != HTTP_CODE_OK) {
+        downloadLimit = MAX_IMAGE_SIZE;
+        return false;
+    }
+    
+    String etag = http.header("ETag");
+    if (!sink->beginFrame(size)) {
+        abortTransfer();
+        downloadLimit = MAX_IMAGE_SIZE;
+        return false;
     }
     
-    url += imagePath;
+    LOGI("Streaming %s", url);
+    bool sinkFailed = false;
+    size_t totalRead = readBody(url, etag, nullptr, sink, size, sinkFailed);
+    downloadLimit = MAX_IMAGE_SIZE;
     
-    return url;
+    bool complete = !sinkFailed && totalRead == size;
+    if (complete) {
+        http.end();
+    } else {
+        abortTransfer();
+        LOGE("Stream incomplete: %u/%u bytes", (unsigned)totalRead, (unsigned)size);
+    }
+    return sink->endFrame(complete) && complete;
 }
 
-bool GitHubImageFetcher::downloadImage(const String& url, uint8_t*& buffer, size_t& size) {
-    HTTPClient http;
+FetchResult GitHubImageFetcher::streamLatestImage(FrameSink* sink, const char* variant) {
+    if (!sink) {
+        return FETCH_FAILED;
+    }
+    
+    if (!configManager || !configManager->isConfigured()) {
+        LOGE("Cannot stream image: configuration not available");
+        return FETCH_FAILED;
+    }
+    
+    if (WiFi.status() != WL_CONNECTED) {
+        LOGE("Cannot stream image: WiFi not connected");
+        return FETCH_FAILED;
+    }
+    
+    char imageURL[MAX_URL_LENGTH];
+    if (!buildImageURL(imageURL, FRAME_FILE_EXTENSION, variant)) {
+        LOGE("Cannot stream image: invalid URL");
+        return FETCH_FAILED;
+    }
+    
+    // The streamed frame replaces any previously buffered one
+    freeBuffer();
+    
+    // Full frames pass through the store on their way to the panel so the
+    // next delta has a base; patched frames are recorded the same way
+    FrameSink* frameSink = sink;
+    if (frameStore) {
+        frameStore->setOutput(sink);
+        frameSink = frameStore;
+    }
+    frameDecoder.setOutput(frameSink);
+    deltaPatcher.setOutput(frameSink);
+    colorQuantizer.setOutput(frameSink);
+    
+    // The manifest says whether there is anything new and when the next
+    // frame is due; servers without one get the old request sequence
+    FrameManifest manifest;
+    bool haveManifest = fetchManifest(manifest, variant);
+    rtcState.nextServerUpdateEpoch = haveManifest ? manifest.nextUpdate : 0;
+    
+    bool haveBase = frameStore && frameStore->hasFrame();
+    if (haveManifest && haveBase && frameStore->getFrameCrc() == manifest.frameCrc) {
+        LOGI("Manifest hash %08X matches the cached frame - nothing to download", manifest.frameCrc);
+        return FETCH_NOT_MODIFIED;
+    }
+    
+    FetchResult result = FETCH_FAILED;
+    
+    // A delta only applies to the frame it was generated against; any
+    // mismatch falls through to the full frame
+    bool deltaUsable = haveBase && 
+                       (!haveManifest || (manifest.hasDelta && manifest.deltaBaseCrc == frameStore->getFrameCrc()));
+    if (deltaUsable) {
+        char deltaURL[MAX_URL_LENGTH];
+        buildImageURL(deltaURL, DELTA_FRAME_EXTENSION, variant);
+        LOGI("Streaming delta from: %s", deltaURL);
+        result = streamImage(deltaURL, &frameDecoder);
+        
+        if (result == FETCH_UPDATED && frameDecoder.isDelta() && deltaPatcher.wasUnchanged()) {
+            result = FETCH_NOT_MODIFIED;
+        } else if (result == FETCH_FAILED) {
+            LOGW("Delta not usable - fetching the full frame");
+        }
+    }
+    
+    // Tiles the device already has come from flash; only the rest is downloaded
+    if (result == FETCH_FAILED && haveManifest && manifest.hasTiles && tileCache) {
+        result = streamTiles(variant, frameSink);
+        if (result == FETCH_FAILED) {
+            LOGW("Tiles not usable - fetching the full frame");
+        }
+    }
+    
+    if (result == FETCH_FAILED) {
+        LOGI("Streaming image from: %s", imageURL);
+        
+        // Decode the container on the fly; raw frames pass straight through
+        result = streamImage(imageURL, &frameDecoder);
+    }
+    
+    // Servers that predate the container only publish the raw frame
+    if (result == FETCH_FAILED && lastHttpCode == HTTP_CODE_NOT_FOUND) {
+        buildImageURL(imageURL, LEGACY_FRAME_EXTENSION, variant);
+        LOGW("No frame container - falling back to: %s", imageURL);
+        result = streamImage(imageURL, &frameDecoder);
+    }
+    
+    // Images from other tools come as plain RGB and are quantized here
+    if (result == FETCH_FAILED && lastHttpCode == HTTP_CODE_NOT_FOUND) {
+        buildImageURL(imageURL, TRUECOLOR_FRAME_EXTENSION, variant);
+        LOGW("No panel frame - trying a true-color image: %s", imageURL);
+        downloadLimit = TRUECOLOR_MAX_SIZE;
+        result = streamImage(imageURL, &frameDecoder);
+        downloadLimit = MAX_IMAGE_SIZE;
+    }
+    
+    return result;
+}
+
+bool GitHubImageFetcher::fetchJson(const char* url, JsonDocument& doc) {
+    size_t size = 0;
+    if (beginDownload(url, size, false) != HTTP_CODE_OK) {
+        return false;
+    }
+    
+    if (size > MANIFEST_MAX_SIZE) {
+        LOGE("JSON document too large: %u bytes", (unsigned)size);
+        abortTransfer();
+        return false;
+    }
+    
+    // Read the whole body so the kept-alive connection is clean for the frame
+    String body = http.getString();
+    http.end();
+    
+    DeserializationError error = deserializeJson(doc, body);
+    if (error || (doc["version"] | 0) != MANIFEST_VERSION) {
+        LOGW("%s not understood - ignoring it", url);
+        return false;
+    }
+    return true;
+}
+
+bool GitHubImageFetcher::fetchManifest(FrameManifest& manifest, const char* variant) {
+    char url[MAX_URL_LENGTH];
+    buildImageURL(url, MANIFEST_EXTENSION, variant);
+    JsonDocument doc;
+    
+    LOGI("Fetching manifest from: %s", url);
+    if (!fetchJson(url, doc) || !doc["hash"].is<const char*>()) {
+        LOGI("No manifest - deciding from the frame request");
+        return false;
+    }
+    
+    manifest.frameCrc = strtoul(doc["hash"].as<const char*>(), nullptr, 16);
+    manifest.frameSize = doc["size"] | 0;
+    manifest.generated = doc["generated"] | 0;
+    manifest.nextUpdate = doc["next_update"] | 0;
+    manifest.hasDelta = doc["delta"]["base"].is<const char*>();
+    manifest.deltaBaseCrc = manifest.hasDelta ? strtoul(doc["delta"]["base"].as<const char*>(), nullptr, 16) : 0;
+    manifest.hasTiles = !doc["tiles"].isNull();
+    
+    LOGI("Manifest: frame %08X (%d bytes, %s), delta %s, tiles %s, next update at %lu",
+         manifest.frameCrc, manifest.frameSize, doc["codec"] | "?", 
+         manifest.hasDelta ? "available" : "none", manifest.hasTiles ? "available" : "none",
+         (unsigned long)manifest.nextUpdate);
+    return true;
+}
+
+bool GitHubImageFetcher::fetchWeather(WeatherData& weather) {
+    if (WiFi.status() != WL_CONNECTED) return false;
+    
+    char url[MAX_URL_LENGTH];
+    if (!buildImageURL(url, WEATHER_EXTENSION)) return false;
+    JsonDocument doc;
+    
+    LOGI("Fetching weather from: %s", url);
+    if (!fetchJson(url, doc) || !doc["base"].is<const char*>()) {
+        LOGI("No weather data - using server-rendered frames");
+        return false;
+    }
+    
+    weather.baseCrc = strtoul(doc["base"].as<const char*>(), nullptr, 16);
+    weather.nextUpdate = doc["next_update"] | 0;
+    weather.utcOffset = doc["utc_offset"] | 0;
+    weather.hasWeather = doc["temperature"].is<int>();
+    weather.temperature = doc["temperature"] | 0;
+    snprintf(weather.icon, sizeof(weather.icon), "%s", (const char*)(doc["icon"] | ""));
+    return true;
+}
+
+int GitHubImageFetcher::beginDownload(const char* url, size_t& size, bool conditional, 
+                                      size_t resumeFrom, const String& ifRange, size_t rangeEnd) {
+    // Connect up front so the handshake is measured on its own; HTTPClient
+    // reuses a client that is already connected
+    if (!client.connected()) {
+        METRIC_START(METRIC_TLS_CONNECT);
+        if (!client.connect(GITHUB_HOST, GITHUB_PORT)) {
+            LOGE("TLS connection to GitHub failed");
+            lastHttpCode = HTTPC_ERROR_CONNECTION_REFUSED;
+            return lastHttpCode;
+        }
+        METRIC_STOP(METRIC_TLS_CONNECT);
+    }
+    
     http.begin(client, url);
     
     // Set timeout
@@ -73,78 +325,433 @@ bool GitHubImageFetcher::downloadImage(const String& url, uint8_t*& buffer, size
     http.addHeader("User-Agent", "ESP32-SmartDashboard/1.0");
     http.addHeader("Accept", "application/octet-stream");
     
-    Serial.println("Starting HTTP GET request for binary e-paper data...");
+    // Only revalidate when the stored ETag belongs to this exact URL
+    if (conditional) {
+        loadETag();
+        if (lastETag.length() > 0 && lastETagUrlHash == hashURL(url)) {
+            http.addHeader("If-None-Match", lastETag);
+            LOGD("Conditional request with ETag: %s", lastETag.c_str());
+        }
+    }
+    
+    // Continue a cut-short body; If-Range makes a changed file come back
+    // whole (200) instead of being spliced onto the old one. A range end
+    // asks for just that part of the file (tile packs).
+    bool ranged = resumeFrom > 0 || rangeEnd > 0;
+    if (ranged) {
+        String range = "bytes=" + String(resumeFrom) + "-";
+        if (rangeEnd > 0) {
+            range += String(rangeEnd);
+        }
+        http.addHeader("Range", range);
+        if (ifRange.length() > 0) {
+            http.addHeader("If-Range", ifRange);
+        }
+    }
+    
+    const char* headerKeys[] = { "ETag", "Content-Range", "Retry-After" };
+    http.collectHeaders(headerKeys, 3);
+    
+    LOGD("Starting HTTP GET request for binary e-paper data...");
+    METRIC_START(METRIC_TIME_TO_FIRST_BYTE);
     int httpCode = http.GET();
+    METRIC_STOP(METRIC_TIME_TO_FIRST_BYTE);
+    lastHttpCode = httpCode;
     
-    if (httpCode != HTTP_CODE_OK) {
-        Serial.printf("HTTP GET failed with code: %d\n", httpCode);
+    // Only the delta-seconds form; GitHub does not send HTTP dates here
+    long retryAfter = httpCode > 0 ? http.header("Retry-After").toInt() : 0;
+    lastRetryAfter = retryAfter > 0 ? (uint32_t)retryAfter : 0;
+    
+    if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        http.end();
+        return httpCode;
+    }
+    
+    int expectedCode = ranged ? HTTP_CODE_PARTIAL_CONTENT : HTTP_CODE_OK;
+    if (httpCode != expectedCode) {
+        LOGE("HTTP GET failed with code: %d", httpCode);
+        if (httpCode == HTTP_CODE_OK) {
+            // If-Range failed or Range was ignored: the whole file follows - drop it
+            abortTransfer();
+            return httpCode;
+        }
         if (httpCode > 0) {
             String payload = http.getString();
-            Serial.printf("Error response: %s\n", payload.c_str());
+            LOGW("Error response: %s", payload.c_str());
         }
         http.end();
-        return false;
+        return httpCode;
     }
     
-    size = http.getSize();
-    Serial.printf("Binary e-paper data size: %d bytes\n", size);
+    int contentLength = http.getSize();
+    LOGD("Binary e-paper data size: %d bytes", contentLength);
     
-    if (size <= 0 || size > MAX_IMAGE_SIZE) {
-        Serial.printf("Invalid binary data size: %d bytes (max: %d)\n", size, MAX_IMAGE_SIZE);
-        http.end();
+    if (contentLength <= 0 || (size_t)contentLength > downloadLimit) {
+        LOGE("Invalid binary data size: %d bytes (max: %u)", contentLength, (unsigned)downloadLimit);
+        abortTransfer();
+        return -1;
+    }
+    
+    size = contentLength;
+    return httpCode;
+}
+
+bool GitHubImageFetcher::downloadImage(const char* url, uint8_t*& buffer, size_t& size) {
+    if (beginDownload(url, size, false) != HTTP_CODE_OK) {
+        size = 0;
         return false;
     }
     
-    // Allocate buffer for binary e-paper data
-    buffer = (uint8_t*)malloc(size);
+    // Borrow a frame buffer from the arena; frames never exceed one slot
+    buffer = frameArena && size <= frameArena->getSlotSize() ? frameArena->acquire("download") : nullptr;
     if (!buffer) {
-        Serial.printf("Failed to allocate %d bytes for e-paper buffer\n", size);
+        LOGE("No frame buffer for %u bytes of e-paper data", (unsigned)size);
+        abortTransfer();
+        return false;
+    }
+    
+    String etag = http.header("ETag");
+    bool sinkFailed = false;
+    
+    LOGD("Downloading binary e-paper data...");
+    size_t totalRead = readBody(url, etag, buffer, nullptr, size, sinkFailed);
+    
+    if (totalRead != size) {
+        abortTransfer();
+        LOGE("Download incomplete: %u/%u bytes", (unsigned)totalRead, (unsigned)size);
+        frameArena->release(buffer);
+        buffer = nullptr;
+        size = 0;
+        return false;
+    }
+    
+    http.end();
+    bufferAllocated = true;
+    bufferSize = size;
+    LOGI("Binary image downloaded successfully!");
+    
+    return true;
+}
+
+FetchResult GitHubImageFetcher::streamImage(const char* url, FrameSink* sink) {
+    size_t size = 0;
+    int httpCode = beginDownload(url, size, true);
+    
+    if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        LOGI("Image not modified since last fetch - skipping download");
+        return FETCH_NOT_MODIFIED;
+    }
+    
+    if (httpCode != HTTP_CODE_OK) {
+        return FETCH_FAILED;
+    }
+    
+    // Header values are only available until http.end()
+    String etag = http.header("ETag");
+    
+    if (!sink->beginFrame(size)) {
+        LOGE("Frame sink rejected the image");
+        abortTransfer();
+        return FETCH_FAILED;
+    }
+    
+    // Each chunk goes to the sink as soon as it arrives, so peak RAM is one
+    // chunk and the SPI upload overlaps the download
+    bool sinkFailed = false;
+    
+    LOGD("Streaming binary e-paper data...");
+    METRIC_START(METRIC_DOWNLOAD);  // Includes the interleaved SPI upload
+    size_t totalRead = readBody(url, etag, nullptr, sink, size, sinkFailed);
+    
+    bool complete = !sinkFailed && totalRead == size;
+    if (complete) {
+        METRIC_STOP(METRIC_DOWNLOAD);
+        METRIC_DOWNLOAD_BYTES(size);
         http.end();
+    } else {
+        abortTransfer();
+        LOGE("Stream incomplete: %u/%u bytes", (unsigned)totalRead, (unsigned)size);
+    }
+    
+    if (!sink->endFrame(complete)) {
+        return FETCH_FAILED;
+    }
+    
+    // Remember the validator only once the frame is actually on the panel
+    saveETag(url, etag);
+    
+    LOGI("Binary image streamed successfully!");
+    return FETCH_UPDATED;
+}
+
+FetchResult GitHubImageFetcher::streamTiles(const char* variant, FrameSink* sink) {
+    uint8_t* frame = frameArena ? frameArena->acquire("tiles") : nullptr;
+    if (!frame) {
+        LOGE("No frame buffer to assemble tiles in");
+        return FETCH_FAILED;
+    }
+    
+    // The decoder takes tile containers until the frame is complete
+    frameDecoder.setGeometry(TILE_SIZE, TILE_SIZE);
+    frameDecoder.setOutput(tileAssembler.getTileOutput());
+    bool assembled = assembleTiles(variant, frame);
+    frameDecoder.setGeometry(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    frameDecoder.setOutput(sink);
+    
+    // Downloaded tiles stay cached even when the frame did not come together
+    tileCache->flush();
+    LOGI("Tile cache: %d hits, %d misses", tileCache->getHits(), tileCache->getMisses());
+    
+    bool shown = false;
+    if (assembled && sink->beginFrame(DISPLAY_FRAME_SIZE)) {
+        bool complete = true;
+        for (size_t offset = 0; complete && offset < DISPLAY_FRAME_SIZE; offset += STREAM_CHUNK_SIZE) {
+            complete = sink->writeFrame(frame + offset, min((size_t)STREAM_CHUNK_SIZE, DISPLAY_FRAME_SIZE - offset));
+        }
+        shown = sink->endFrame(complete) && complete;
+    }
+    frameArena->release(frame);
+    
+    if (!shown) {
+        return FETCH_FAILED;
+    }
+    LOGI("Tiled frame assembled successfully!");
+    return FETCH_UPDATED;
+}
+
+bool GitHubImageFetcher::assembleTiles(const char* variant, uint8_t* frame) {
+    char indexURL[MAX_URL_LENGTH];
+    buildImageURL(indexURL, TILE_INDEX_EXTENSION, variant);
+    LOGI("Fetching tile index from: %s", indexURL);
+    
+    size_t size = 0;
+    if (beginDownload(indexURL, size, false) != HTTP_CODE_OK) {
+        return false;
+    }
+    if (size > TILE_INDEX_MAX_SIZE) {
+        LOGE("Tile index too large: %u bytes", (unsigned)size);
+        abortTransfer();
         return false;
     }
     
-    // Read binary e-paper data
-    WiFiClient* stream = http.getStreamPtr();
-    size_t bytesRead = 0;
-    size_t totalRead = 0;
-    unsigned long timeout = millis();
+    bool sinkFailed = false;
+    if (readBody(indexURL, "", tileAssembler.getIndexBuffer(), nullptr, size, sinkFailed) != size) {
+        abortTransfer();
+        return false;
+    }
+    http.end();
     
-    Serial.println("Downloading binary e-paper data...");
+    if (!tileAssembler.begin(frame, size)) {
+        return false;
+    }
     
-    while (totalRead < size && (millis() - timeout) < 30000) {
-        if (stream->available()) {
-            bytesRead = stream->readBytes(buffer + totalRead, size - totalRead);
+    // Every range goes over the same kept-alive connection
+    char packURL[MAX_URL_LENGTH];
+    buildImageURL(packURL, TILE_PACK_EXTENSION, variant);
+    uint32_t start = 0;
+    uint32_t end = 0;
+    while (tileAssembler.nextRange(start, end)) {
+        if (!fetchRange(packURL, start, end, &tileAssembler)) {
+            return false;
+        }
+    }
+    return tileAssembler.finish();
+}
+
+bool GitHubImageFetcher::fetchRange(const char* url, uint32_t start, uint32_t end, FrameSink* sink) {
+    size_t size = 0;
+    if (beginDownload(url, size, false, start, "", end) != HTTP_CODE_PARTIAL_CONTENT) {
+        return false;
+    }
+    
+    // Content-Range: bytes <start>-<end>/<file size>
+    String range = http.header("Content-Range");
+    if (!range.startsWith("bytes " + String(start) + "-" + String(end) + "/") || size != end - start + 1) {
+        LOGE("Unexpected Content-Range '%s' for bytes %lu-%lu", range.c_str(), 
+             (unsigned long)start, (unsigned long)end);
+        abortTransfer();
+        return false;
+    }
+    
+    if (!sink->beginFrame(size)) {
+        abortTransfer();
+        return false;
+    }
+    
+    // No resume: a stalled range fails the tiles and the full frame follows
+    bool sinkFailed = false;
+    size_t totalRead = readBody(url, "", nullptr, sink, size, sinkFailed);
+    
+    bool complete = !sinkFailed && totalRead == size;
+    if (complete) {
+        http.end();
+    } else {
+        abortTransfer();
+        LOGE("Range incomplete: %u/%u bytes", (unsigned)totalRead, (unsigned)size);
+    }
+    return sink->endFrame(complete) && complete;
+}
+
+size_t GitHubImageFetcher::readBody(const char* url, const String& etag, uint8_t* buffer, 
+                                    FrameSink* sink, size_t size, bool& sinkFailed) {
+    size_t totalRead = 0;
+    size_t nextProgress = 0;
+    int resumes = 0;
+    
+    for (;;) {
+        WiFiClient* stream = http.getStreamPtr();
+        unsigned long timeout = millis();
+        
+        while (totalRead < size && (millis() - timeout) < DOWNLOAD_STALL_TIMEOUT_MS) {
+            size_t available = stream->available();
+            if (!available) {
+                if (!stream->connected()) break;  // Dropped - no point waiting out the timeout
+                logFlush();  // Idle anyway; the UART takes what fits without blocking
+                delay(1);
+                continue;
+            }
+            
+            // Buffered downloads land in place; streamed ones bounce through
+            // the chunk on their way to the sink
+            uint8_t* target = buffer ? buffer + totalRead : streamChunk;
+            size_t limit = buffer ? size - totalRead : min(sizeof(streamChunk), size - totalRead);
+            size_t bytesRead = stream->readBytes(target, min(available, limit));
+            
+            if (sink && bytesRead > 0 && !sink->writeFrame(streamChunk, bytesRead)) {
+                sinkFailed = true;
+                return totalRead;
+            }
             totalRead += bytesRead;
             timeout = millis(); // Reset timeout on successful read
             
-            if (totalRead % 10000 == 0 || totalRead == size) {
-                Serial.printf("Downloaded: %d/%d bytes (%.1f%%)\n", 
-                             totalRead, size, (float)totalRead * 100.0 / size);
+            if (totalRead >= nextProgress || totalRead == size) {
+                LOGD("Received: %d/%d bytes (%d%%)", totalRead, size, (int)((uint64_t)totalRead * 100 / size));
+                nextProgress = totalRead + 10000;
             }
         }
-        delay(1);
+        
+        if (totalRead == size) {
+            return totalRead;
+        }
+        
+        // Everything received so far is already in the buffer or downstream
+        // (decoder, frame store slot, panel RAM), so only the rest is fetched
+        // again. Without a validator the two halves could be different files.
+        if (etag.length() == 0 || resumes >= DOWNLOAD_RESUME_ATTEMPTS) {
+            return totalRead;
+        }
+        resumes++;
+        
+        LOGW("Transfer stalled at %u/%u bytes - resuming (attempt %d/%d)", 
+             (unsigned)totalRead, (unsigned)size, resumes, DOWNLOAD_RESUME_ATTEMPTS);
+        abortTransfer();
+        delay(DOWNLOAD_RESUME_DELAY_MS * resumes);
+        
+        if (!resumeDownload(url, etag, totalRead, size)) {
+            return totalRead;
+        }
     }
-    
-    http.end();
-    
-    if (totalRead != size) {
-        Serial.printf("Download incomplete: %d/%d bytes\n", totalRead, size);
-        free(buffer);
-        buffer = nullptr;
-        size = 0;
+}
+
+bool GitHubImageFetcher::resumeDownload(const char* url, const String& etag, size_t offset, size_t size) {
+    size_t remaining = 0;
+    if (beginDownload(url, remaining, false, offset, etag) != HTTP_CODE_PARTIAL_CONTENT) {
+        LOGW("Server did not resume the transfer");
         return false;
     }
     
-    bufferAllocated = true;
-    bufferSize = size;
-    Serial.println("Binary image downloaded successfully!");
+    // Content-Range: bytes <offset>-<size - 1>/<size>
+    String range = http.header("Content-Range");
+    if (!range.startsWith("bytes " + String(offset) + "-") || !range.endsWith("/" + String(size)) ||
+        remaining != size - offset) {
+        LOGE("Unexpected Content-Range '%s' - not resuming", range.c_str());
+        abortTransfer();
+        return false;
+    }
     
+    LOGI("Resumed at byte %u, %u bytes to go", (unsigned)offset, (unsigned)remaining);
     return true;
 }
 
+void GitHubImageFetcher::loadETag() {
+    if (etagLoaded) {
+        return;
+    }
+    
+    // RTC memory survives deep sleep, so NVS is only read after a cold boot
+    if (rtcState.etagUrlHash != 0) {
+        lastETag = rtcState.etag;
+        lastETagUrlHash = rtcState.etagUrlHash;
+    } else {
+        prefs.begin("fetcher", true);
+        lastETag = prefs.getString("etag", "");
+        lastETagUrlHash = prefs.getUInt("etag_url", 0);
+        prefs.end();
+        cacheETagInRtc();
+    }
+    etagLoaded = true;
+}
+
+void GitHubImageFetcher::saveETag(const char* url, const String& etag) {
+    loadETag();
+    uint32_t urlHash = hashURL(url);
+    if (etag == lastETag && urlHash == lastETagUrlHash) {
+        return;
+    }
+    
+    prefs.begin("fetcher", false);
+    prefs.putString("etag", etag);
+    prefs.putUInt("etag_url", urlHash);
+    prefs.end();
+    
+    lastETag = etag;
+    lastETagUrlHash = urlHash;
+    cacheETagInRtc();
+}
+
+void GitHubImageFetcher::clearETag() {
+    prefs.begin("fetcher", false);
+    prefs.clear();
+    prefs.end();
+    
+    lastETag = "";
+    lastETagUrlHash = 0;
+    etagLoaded = true;
+    cacheETagInRtc();
+}
+
+void GitHubImageFetcher::cacheETagInRtc() {
+    // ETags that do not fit are simply not cached; NVS still has them
+    if (lastETag.length() >= RTC_ETAG_LENGTH) {
+        rtcState.etagUrlHash = 0;
+        rtcState.etag[0] = '\0';
+        return;
+    }
+    
+    strcpy(rtcState.etag, lastETag.c_str());
+    rtcState.etagUrlHash = lastETag.length() > 0 ? lastETagUrlHash : 0;
+}
+
+uint32_t GitHubImageFetcher::hashURL(const char* url) {
+    return frameCrc32(0, (const uint8_t*)url, strlen(url));
+}
+
+void GitHubImageFetcher::abortTransfer() {
+    // Unread body bytes would corrupt the next response on a reused connection
+    http.end();
+    client.stop();
+}
+
+void GitHubImageFetcher::endSession() {
+    http.end();
+    if (client.connected()) {
+        client.stop();
+    }
+}
+
 void GitHubImageFetcher::freeBuffer() {
     if (bufferAllocated && imageBuffer) {
-        free(imageBuffer);
+        frameArena->release(imageBuffer);
         imageBuffer = nullptr;
         bufferSize = 0;
         bufferAllocated = false;
@@ -153,22 +760,25 @@ void GitHubImageFetcher::freeBuffer() {
 
 bool GitHubImageFetcher::testConnection() {
     if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("WiFi not connected");
+        LOGE("WiFi not connected");
         return false;
     }
     
+    // Own client so the probe never tears down the kept-alive image connection
+    WiFiClientSecure probeClient;
+    probeClient.setInsecure();
     HTTPClient http;
-    http.begin(client, "https://api.github.com");
+    http.begin(probeClient, "https://api.github.com");
     http.setTimeout(10000);
     
     int httpCode = http.GET();
     http.end();
     
     if (httpCode == HTTP_CODE_OK) {
-        Serial.println("GitHub connection test successful");
+        LOGI("GitHub connection test successful");
         return true;
     } else {
-        Serial.printf("GitHub connection test failed with code: %d\n", httpCode);
+        LOGE("GitHub connection test failed with code: %d", httpCode);
         return false;
     }
 }
@@ -0,0 +1,104 @@
+#include "logger.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+#include <atomic>
+#include <stdarg.h>
+
+#define LOGGER_MASK (LOGGER_BUFFER_SIZE - 1)
+
+static_assert((LOGGER_BUFFER_SIZE & LOGGER_MASK) == 0, "LOGGER_BUFFER_SIZE must be a power of two");
+static_assert(LOGGER_LINE_MAX <= 256, "Line lengths are stored in one byte");
+
+// Records are a length byte followed by the line. Writers claim space by
+// moving writePos and store the length last, so a record still being
+// written reads as length 0. The reader zeroes what it has sent.
+static uint8_t ring[LOGGER_BUFFER_SIZE];
+static std::atomic<uint32_t> writePos(0);
+static std::atomic<uint32_t> readPos(0);
+static std::atomic<uint32_t> droppedLines(0);
+static std::atomic_flag flushing = ATOMIC_FLAG_INIT;
+// Bytes of the oldest record already sent; the UART FIFO is smaller than
+// a long line, so a non-blocking flush may stop part way through one
+static uint32_t sentOfRecord = 0;
+
+void logWrite(const char* format, ...) {
+    char line[LOGGER_LINE_MAX];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line) - 1, format, args);
+    va_end(args);
+    if (length < 0) {
+        return;
+    }
+    length = min(length, (int)sizeof(line) - 2);
+    line[length++] = '\n';
+    
+    uint32_t size = length + 1;
+    uint32_t start = writePos.load(std::memory_order_relaxed);
+    do {
+        if (start + size - readPos.load(std::memory_order_acquire) > LOGGER_BUFFER_SIZE) {
+            droppedLines.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    } while (!writePos.compare_exchange_weak(start, start + size, std::memory_order_relaxed));
+    
+    for (int i = 0; i < length; i++) {
+        ring[(start + 1 + i) & LOGGER_MASK] = line[i];
+    }
+    __atomic_store_n(&ring[start & LOGGER_MASK], (uint8_t)length, __ATOMIC_RELEASE);
+}
+
+void logFlush(bool drain) {
+    // One task flushes at a time; the others just carry on
+    if (flushing.test_and_set(std::memory_order_acquire)) {
+        return;
+    }
+    
+    uint32_t pos = readPos.load(std::memory_order_relaxed);
+    while (pos != writePos.load(std::memory_order_relaxed)) {
+        uint8_t length = __atomic_load_n(&ring[pos & LOGGER_MASK], __ATOMIC_ACQUIRE);
+        if (length == 0) {
+            break;
+        }
+        
+        size_t count = length - sentOfRecord;
+        if (!drain) {
+            int space = Serial.availableForWrite();
+            if (space <= 0) {
+                break;
+            }
+            count = min(count, (size_t)space);
+        }
+        
+        uint32_t first = (pos + 1 + sentOfRecord) & LOGGER_MASK;
+        size_t head = min(count, (size_t)(LOGGER_BUFFER_SIZE - first));
+        Serial.write(ring + first, head);
+        if (head < count) {
+            Serial.write(ring, count - head);
+        }
+        sentOfRecord += count;
+        if (sentOfRecord < length) {
+            break;
+        }
+        
+        for (uint32_t i = 0; i <= length; i++) {
+            ring[(pos + i) & LOGGER_MASK] = 0;
+        }
+        sentOfRecord = 0;
+        pos += length + 1;
+        readPos.store(pos, std::memory_order_release);
+    }
+    
+    if (drain) {
+        uint32_t dropped = droppedLines.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) {
+            Serial.printf("(%lu log lines dropped)\n", (unsigned long)dropped);
+        }
+        Serial.flush();
+    }
+    flushing.clear(std::memory_order_release);
+}
+
+uint32_t logDropped() {
+    return droppedLines.load(std::memory_order_relaxed);
+}
@@ -1,59 +1,116 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <SPI.h>
-#include <Update.h>
 #include "serial_config.h"  // Must be included first
 #include "config.h"
 #include "config_manager.h"
 #include "display_handler.h"
 #include "web_server.h"
 #include "github_fetcher.h"
-#include "utils.h"
+#include "frame_store.h"
+#include "tile_cache.h"
+#include "frame_arena.h"
+#include "frame_pipeline.h"
+#include "weather_overlay.h"
+#include "update_scheduler.h"
+#include "update_policy.h"
+#include "ota_updater.h"
+#include "frame_format.h"
+#include "metrics.h"
+#include "logger.h"
+
+// Log section rules
+#define BANNER_RULE  "=================================================="
+#define SECTION_RULE "----------------------------------------"
 
 // Global objects
 ConfigManager configManager;
 DisplayHandler display;
 WebConfigServer webServer(&configManager);
 GitHubImageFetcher imageFetcher(&configManager);
+FrameStore frameStore;
+TileCache tileCache;  // Base-map tiles shared by every view
+FrameArena frameArena;
+FramePipeline displayPipeline;  // Network task -> display task
+WeatherOverlay weatherOverlay;
+DiscardSink prefetchSink;  // Playlist frames go to flash only
+UpdateScheduler scheduler;
+UpdatePolicy updatePolicy;
+OtaUpdater otaUpdater;
 
 // State variables
 bool isConfigMode = false;
-unsigned long lastUpdateTime = 0;
-unsigned long lastWiFiCheck = 0;
-bool firstRun = true;
+bool frameStoreReady = false;
 
 // Function declarations
 void setup();
 void loop();
 bool connectToWiFi();
-void enterConfigMode();
+bool waitForWiFi(unsigned long timeoutMs);
+void cacheWiFiConnection(uint32_t credentialHash);
+void enterConfigMode(const char* screen = "Configuration Mode");
 void exitConfigMode();
-void updateDashboard();
-void checkWiFiConnection();
+bool updateDashboard();
+FetchResult updateWeatherOverlay(const WeatherData& weather);
+bool playlistActive();
+bool updatePlaylist();
+bool showPlaylistView(bool advance);
+void goToSleep();
+void restartIntoUpdate();
 void printSystemInfo();
 
 void setup() {
     initSerial();  // Initialize hardware UART
-    delay(1000);
+    scheduler.begin();
+#if METRICS_ENABLED
+    metricsBegin(scheduler.wokeFromTimer());
+#endif
+    updatePolicy.begin();  // Battery reading before the radio loads the supply
+    webServer.setUpdatePolicy(&updatePolicy);
     
-    Serial.println("\n" + repeat("=", 50));
-    Serial.println("ESP32-S2 Smart Dashboard Starting...");
-    Serial.println("Version: 1.0.0");
-    Serial.println("Display: 7.3\" 7-color E-Paper (800x480)");
-    Serial.println(repeat("=", 50));
+    // Timer wakeups skip the banner and settle delay - it is pure awake time
+    if (!scheduler.wokeFromTimer()) {
+        delay(1000);
+        
+        Serial.println("\n" BANNER_RULE);
+        Serial.println("ESP32-S2 Smart Dashboard Starting...");
+        Serial.printf("Version: %s (build %d)\n", FIRMWARE_VERSION, FIRMWARE_BUILD);
+        Serial.println("Display: 7.3\" 7-color E-Paper (800x480)");
+        Serial.println(BANNER_RULE);
+    }
     
-    // Initialize EEPROM and configuration
+    // Load the configuration record from NVS
     Serial.println("Initializing configuration manager...");
     if (!configManager.init()) {
         Serial.println("Failed to initialize configuration manager");
     }
     
+    // Frame-sized buffers are reserved here, once, before the heap fragments
+    frameArena.begin();
+    display.setFrameArena(&frameArena);
+    imageFetcher.setFrameArena(&frameArena);
+    otaUpdater.setFrameArena(&frameArena);
+    otaUpdater.begin(!scheduler.wokeFromTimer());
+    
     // Initialize display
     Serial.println("Initializing display...");
     if (!display.initialize()) {
         Serial.println("WARNING: Display initialization failed!");
         Serial.println("Continuing without display...");
     }
+    displayPipeline.setOutput(&display);
+    displayPipeline.begin();
+    
+    // Last displayed frame: redraw source and base for delta downloads.
+    // Its CRC is only re-checked on cold boot; timer wakeups trust the slot.
+    frameStoreReady = frameStore.begin(!scheduler.wokeFromTimer());
+    if (frameStoreReady) {
+        imageFetcher.setFrameStore(&frameStore);
+        if (tileCache.begin()) {
+            imageFetcher.setTileCache(&tileCache);
+        }
+    }
+    weatherOverlay.setOutput(&displayPipeline);
     
     // Check if device is configured
     if (!configManager.isConfigured()) {
@@ -66,8 +123,7 @@ void setup() {
             // Continue to WiFi connection attempt below
         } else {
             Serial.println("No default configuration available - entering configuration mode");
-            display.showStatus("Configuration Mode");  // This will show the QR code
-            enterConfigMode();
+            enterConfigMode();  // This will show the QR code
             printSystemInfo();
             Serial.println("Setup complete - in configuration mode!");
             return; // Exit setup early when in config mode
@@ -77,44 +133,117 @@ void setup() {
         configManager.printConfig();
     }
     
+    // Between server updates a playlist only rotates views from flash
+    scheduler.setDwell(playlistActive() ? configManager.getDwellSeconds() : 0);
+    if (playlistActive() && !scheduler.refreshDue()) {
+        showPlaylistView(scheduler.rotationDue());
+        Serial.println("Setup complete!");
+        goToSleep();
+        return;
+    }
+    
     // At this point we have configuration (either saved or default)
     Serial.println("Configuration available - attempting to connect to WiFi");
     
     if (connectToWiFi()) {
-        Serial.println("Connected to WiFi - starting normal operation");
-        // Don't display anything - wait for image fetch
-        lastUpdateTime = 0; // Force immediate update
-    } else {
+        Serial.println("Connected to WiFi - starting update cycle");
+        updatePolicy.recordLink(WiFi.RSSI());
+        scheduler.syncClock();
+        
+        if (!scheduler.wokeFromTimer()) {
+            scheduler.staggerColdStart();
+        }
+        
+        bool updated = updateDashboard();
+        updatePolicy.recordDownload();
+        if (updated) {
+            scheduler.recordSuccess();
+        } else {
+            scheduler.recordFailure(imageFetcher.getLastHttpCode(), imageFetcher.getRetryAfter());
+        }
+        
+        // A new image is kept once it got through an update cycle; failed
+        // ones only count against it
+        otaUpdater.confirm(updated);
+        
+#if OTA_ENABLED
+        // Same connection; the panel refresh continues in the background
+        if (updated && updatePolicy.allowOta() && otaUpdater.checkDue() && otaUpdater.install(imageFetcher)) {
+            restartIntoUpdate();
+        }
+#endif
+    } else if (!scheduler.wokeFromTimer() || 
+               scheduler.getConsecutiveFailures() + 1 >= WIFI_FAILURES_BEFORE_CONFIG) {
         Serial.println("Failed to connect to WiFi - entering configuration mode");
+        otaUpdater.confirm(false);
         // Only show display for configuration mode
-        display.showStatus("Configuration Mode");
-        enterConfigMode();
+        enterConfigMode("WiFi Connection Failed");
+        printSystemInfo();
+        return;
+    } else {
+        // A temporary outage on a timer wakeup just retries later
+        Serial.println("Failed to connect to WiFi - retrying after backoff");
+        scheduler.recordFailure();
+        otaUpdater.confirm(false);
     }
     
-    printSystemInfo();
+    if (!scheduler.wokeFromTimer()) {
+        printSystemInfo();
+    }
     Serial.println("Setup complete!");
+    
+    goToSleep();
 }
 
 void loop() {
+    // Normal operation runs once in setup() and ends in deep sleep; only
+    // configuration mode stays awake here
     if (isConfigMode) {
-        // Handle configuration mode
         webServer.handleClient();
+        logFlush();
         delay(100);
     } else {
-        // Normal operation mode
-        checkWiFiConnection();
-        
-        // Check if it's time to update the dashboard
-        unsigned long currentTime = millis();
-        if (firstRun || (currentTime - lastUpdateTime >= UPDATE_INTERVAL_MS)) {
-            updateDashboard();
-            lastUpdateTime = currentTime;
-            firstRun = false;
-        }
-        
-        // Sleep for a while to save power
-        delay(30000); // Check every 30 seconds
+        goToSleep();
+    }
+}
+
+void goToSleep() {
+    imageFetcher.endSession();
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    
+    // A refresh started by the update finishes here, in light sleep
+    if (displayPipeline.quiesce()) {
+        display.setLowPowerWait(true);
+        display.sleep();
+    } else {
+        Serial.println("Display task stuck - sleeping without powering the panel down");
+    }
+    
+    METRIC_RECORD(METRIC_AWAKE, METRIC_NOW());
+    logFlush(true);
+    METRICS_PRINT();
+    
+    scheduler.setIntervalScale(updatePolicy.intervalScale());
+    Serial.printf("Update policy: %s (every %lu generation slots)\n", 
+                  updatePolicy.describe(), (unsigned long)updatePolicy.intervalScale());
+    scheduler.sleepUntilNextUpdate();
+}
+
+void restartIntoUpdate() {
+    imageFetcher.endSession();
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    
+    // Let the panel finish before the reset cuts its power sequence short
+    if (displayPipeline.quiesce()) {
+        display.sleep();
     }
+    
+    logFlush(true);
+    Serial.println("Restarting into the new firmware...");
+    Serial.flush();
+    ESP.restart();
 }
 
 bool connectToWiFi() {
@@ -128,28 +257,46 @@ bool connectToWiFi() {
     
     Serial.printf("Connecting to WiFi: %s\n", ssid);
     
+    // Credentials come from ConfigManager; don't rewrite them to flash every wake
+    WiFi.persistent(false);
     WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
     
-    int attempts = 0;
-    const int maxAttempts = 30; // 30 seconds timeout
+    uint32_t credentialHash = frameCrc32(0, (const uint8_t*)ssid, strlen(ssid));
+    credentialHash = frameCrc32(credentialHash, (const uint8_t*)password, strlen(password));
+    unsigned long start = millis();
+    METRIC_START(METRIC_WIFI_CONNECT);
     
-    while (WiFi.status() != WL_CONNECTED && attempts < maxAttempts) {
-        delay(1000);
-        attempts++;
-        Serial.printf("WiFi connection attempt %d/%d\n", attempts, maxAttempts);
+    // Fast path: join the cached AP directly and reuse the previous lease
+    if (rtcState.wifiCacheValid && rtcState.wifiCredentialHash == credentialHash &&
+        rtcState.wifiCacheUses < WIFI_CACHE_MAX_REUSE) {
+        WiFi.config(IPAddress(rtcState.wifiIP), IPAddress(rtcState.wifiGateway),
+                    IPAddress(rtcState.wifiSubnet), IPAddress(rtcState.wifiDNS));
+        WiFi.begin(ssid, password, rtcState.wifiChannel, rtcState.wifiBssid);
         
-        // Don't show progress on display - keep it blank
-        if (attempts % 5 == 0) {
-            // Just log progress, don't display anything
-            Serial.printf("WiFi connection progress: %d/%d attempts\n", attempts, maxAttempts);
+        if (waitForWiFi(WIFI_FAST_CONNECT_TIMEOUT_MS)) {
+            METRIC_STOP(METRIC_WIFI_CONNECT);
+            rtcState.wifiCacheUses++;
+            Serial.printf("WiFi connected in %lu ms (cached channel %d)\n", 
+                          millis() - start, rtcState.wifiChannel);
+            Serial.printf("RSSI: %d dBm\n", WiFi.RSSI());
+            return true;
         }
+        
+        Serial.println("Fast reconnect failed - falling back to full scan and DHCP");
+        rtcState.wifiCacheValid = 0;
+        WiFi.disconnect();
+        WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
     }
     
-    if (WiFi.status() == WL_CONNECTED) {
+    WiFi.begin(ssid, password);
+    
+    if (waitForWiFi(WIFI_CONNECT_TIMEOUT_MS)) {
+        METRIC_STOP(METRIC_WIFI_CONNECT);
         Serial.println("WiFi connected successfully!");
+        Serial.printf("Connected in %lu ms\n", millis() - start);
         Serial.printf("IP address: %s\n", WiFi.localIP().toString().c_str());
         Serial.printf("RSSI: %d dBm\n", WiFi.RSSI());
+        cacheWiFiConnection(credentialHash);
         return true;
     } else {
         Serial.println("WiFi connection failed");
@@ -157,18 +304,64 @@ bool connectToWiFi() {
     }
 }
 
-void enterConfigMode() {
+bool waitForWiFi(unsigned long timeoutMs) {
+    unsigned long start = millis();
+    unsigned long lastLog = start;
+    
+    while (WiFi.status() != WL_CONNECTED && millis() - start < timeoutMs) {
+        delay(WIFI_POLL_INTERVAL_MS);
+        logFlush();
+        
+        // Don't show progress on display - just log it once per second
+        if (millis() - lastLog >= 1000) {
+            lastLog = millis();
+            LOGD("WiFi connection progress: %lu/%lu ms", lastLog - start, timeoutMs);
+        }
+    }
+    
+    return WiFi.status() == WL_CONNECTED;
+}
+
+void cacheWiFiConnection(uint32_t credentialHash) {
+    uint8_t* bssid = WiFi.BSSID();
+    if (!bssid) {
+        rtcState.wifiCacheValid = 0;
+        return;
+    }
+    
+    memcpy(rtcState.wifiBssid, bssid, sizeof(rtcState.wifiBssid));
+    rtcState.wifiChannel = WiFi.channel();
+    rtcState.wifiIP = (uint32_t)WiFi.localIP();
+    rtcState.wifiGateway = (uint32_t)WiFi.gatewayIP();
+    rtcState.wifiSubnet = (uint32_t)WiFi.subnetMask();
+    rtcState.wifiDNS = (uint32_t)WiFi.dnsIP(0);
+    rtcState.wifiCredentialHash = credentialHash;
+    rtcState.wifiCacheUses = 0;
+    rtcState.wifiCacheValid = 1;
+}
+
+void enterConfigMode(const char* screen) {
     Serial.println("Entering configuration mode...");
     isConfigMode = true;
     
+    // The status screens bypass the pipeline
+    bool displayIdle = displayPipeline.quiesce();
+    if (!displayIdle) {
+        Serial.println("Display task stuck - status screen skipped");
+    }
+    
     if (!webServer.startConfigAP()) {
         Serial.println("Failed to start configuration server");
-        display.showStatus("Config Server Failed");
+        if (displayIdle) {
+            display.showStatus("Config Server Failed");
+        }
         return;
     }
     
-    // Show QR code for easy WiFi connection
-    display.showStatus("Configuration Mode");
+    // Show QR code for easy WiFi connection; one refresh, once the AP is up
+    if (displayIdle) {
+        display.showStatus(screen);
+    }
     
     Serial.println("Configuration mode active - waiting for user input");
 }
@@ -179,62 +372,153 @@ void exitConfigMode() {
     webServer.stopServer();
 }
 
-void updateDashboard() {
-    Serial.println("\n" + repeat("-", 40));
-    Serial.println("Starting dashboard update...");
+bool updateDashboard() {
+    LOGI("\n" SECTION_RULE);
+    LOGI("Starting dashboard update...");
     
     // Don't display anything during fetch - keep display blank
     
-    // Test GitHub connection first
-    if (!imageFetcher.testConnection()) {
-        Serial.println("GitHub connection test failed");
-        // Don't display error - just log it
-        return;
+    // No separate GitHub probe - the image request itself reports reachability
+    // and a probe would cost a second TLS handshake
+    FetchResult result = FETCH_FAILED;
+    bool overlayMode = false;
+    
+    if (playlistActive()) {
+        bool updated = updatePlaylist();
+        LOGI(SECTION_RULE);
+        return updated;
     }
     
-    // Fetch the latest image
-    if (imageFetcher.fetchLatestImage()) {
-        Serial.println("Image fetched successfully");
-        
-        uint8_t* imageData = imageFetcher.getImageBuffer();
-        size_t imageSize = imageFetcher.getImageSize();
-        
-        Serial.printf("Displaying image (%d bytes)\n", imageSize);
-        // This is the ONLY display call - show the fetched image
-        display.displayImage(imageData, imageSize);
-        
-        Serial.println("Dashboard update completed successfully");
+#if WEATHER_OVERLAY_ENABLED
+    // The overlay is drawn onto the cached base map, so it needs the store
+    WeatherData weather;
+    if (frameStoreReady && imageFetcher.fetchWeather(weather)) {
+        overlayMode = true;
+        result = updateWeatherOverlay(weather);
+    }
+#endif
+    
+    // SPI upload runs on the display task while this one keeps reading TLS
+    if (!overlayMode) {
+        result = imageFetcher.streamLatestImage(&displayPipeline);
+    }
+    
+    if (result == FETCH_UPDATED) {
+        LOGI("Dashboard update completed successfully");
+    } else if (result == FETCH_NOT_MODIFIED) {
+        LOGI("Image unchanged - panel refresh skipped");
     } else {
-        Serial.println("Failed to fetch image from GitHub");
-        // Don't display error - just log it and keep display blank
+        LOGE("Failed to fetch image from GitHub");
+        // Don't display error - just log it and keep the previous image
+    }
+    
+    // Nothing new arrived but the panel shows something else - put the
+    // cached frame back without downloading it again
+    if (!overlayMode && result != FETCH_UPDATED && !display.showsFrame() && frameStore.hasFrame()) {
+        frameStore.replay(&displayPipeline);
     }
     
-    Serial.println(repeat("-", 40));
+    LOGI(SECTION_RULE);
+    return result != FETCH_FAILED;
 }
 
-void checkWiFiConnection() {
-    unsigned long currentTime = millis();
-    
-    // Check WiFi every 30 seconds
-    if (currentTime - lastWiFiCheck >= WIFI_RETRY_DELAY_MS) {
-        if (WiFi.status() != WL_CONNECTED) {
-            Serial.println("WiFi disconnected - attempting to reconnect");
-            
-            if (!connectToWiFi()) {
-                Serial.println("WiFi reconnection failed - entering configuration mode");
-                display.showStatus("WiFi Lost - Config Mode");
-                delay(3000);
-                enterConfigMode();
-            }
+FetchResult updateWeatherOverlay(const WeatherData& weather) {
+    rtcState.nextServerUpdateEpoch = weather.nextUpdate;
+    time_t now = scheduler.hasValidClock() ? time(nullptr) : 0;
+    uint32_t overlayCrc = weatherOverlay.render(weather, now);
+    
+    // Only a changed base map is downloaded; it is recorded unpatched and
+    // reaches the panel with the overlay already drawn in
+    if (!frameStore.hasFrame() || frameStore.getFrameCrc() != weather.baseCrc) {
+        FetchResult result = imageFetcher.streamLatestImage(&weatherOverlay, BASE_FRAME_VARIANT);
+        if (result != FETCH_NOT_MODIFIED) {
+            return result;
+        }
+    }
+    
+    if (display.showsFrame() && rtcState.overlayCrc == overlayCrc) {
+        LOGI("Overlay unchanged - panel refresh skipped");
+        return FETCH_NOT_MODIFIED;
+    }
+    
+    // A refresh costs far more battery than the wake; a clock running a
+    // little behind is the cheaper trade
+    if (display.showsFrame() && updatePolicy.deferOverlay(weather, now)) {
+        LOGI("Low battery - clock-only overlay change, panel refresh skipped");
+        return FETCH_NOT_MODIFIED;
+    }
+    
+    // Same base, new weather or time: redraw from flash, nothing downloaded
+    LOGI("Drawing weather overlay onto the cached base map");
+    if (!frameStore.hasFrame() || !frameStore.replay(&weatherOverlay)) {
+        return FETCH_FAILED;
+    }
+    return FETCH_UPDATED;
+}
+
+bool playlistActive() {
+    return frameStoreReady && configManager.getViewCount() > 1;
+}
+
+bool updatePlaylist() {
+    // Every view goes through the store into flash over the kept-alive
+    // connection; its manifest and ETag skip frames that did not change
+    uint8_t count = configManager.getViewCount();
+    uint8_t failures = 0;
+    for (uint8_t view = 0; view < count; view++) {
+        frameStore.selectView(view);
+        imageFetcher.selectView(view);
+        FetchResult result = imageFetcher.streamLatestImage(&prefetchSink);
+        if (result == FETCH_FAILED) {
+            failures++;
         }
-        lastWiFiCheck = currentTime;
+        LOGI("View %d/%d: %s", view + 1, count, 
+             result == FETCH_UPDATED ? "updated" : 
+             result == FETCH_NOT_MODIFIED ? "unchanged" : "failed");
+    }
+    imageFetcher.selectView(0);
+    
+    bool shown = showPlaylistView(scheduler.rotationDue());
+    return failures == 0 && shown;
+}
+
+bool showPlaylistView(bool advance) {
+    uint8_t count = configManager.getViewCount();
+    uint8_t view = rtcState.playlistView;
+    if (view >= count) {
+        view = 0;
+    } else if (advance) {
+        view = (view + 1) % count;
+    }
+    
+    // Views that have never downloaded are skipped
+    for (uint8_t i = 0; i < count && !(frameStore.selectView(view) && frameStore.hasFrame()); i++) {
+        view = (view + 1) % count;
+    }
+    if (!frameStore.hasFrame()) {
+        Serial.println("No playlist view cached yet");
+        frameStore.selectView(0);
+        return false;
+    }
+    
+    rtcState.playlistView = view;
+    uint32_t crc = frameStore.getFrameCrc();
+    bool shown = true;
+    if (display.showsFrame() && rtcState.playlistShownCrc == crc) {
+        Serial.printf("View %d already on the panel\n", view + 1);
+    } else {
+        Serial.printf("Showing playlist view %d/%d\n", view + 1, count);
+        shown = frameStore.replay(&displayPipeline);
+        rtcState.playlistShownCrc = shown ? crc : 0;
     }
+    frameStore.selectView(0);
+    return shown;
 }
 
 void printSystemInfo() {
-    Serial.println("\n" + repeat("=", 50));
+    Serial.println("\n" BANNER_RULE);
     Serial.println("SYSTEM INFORMATION");
-    Serial.println(repeat("=", 50));
+    Serial.println(BANNER_RULE);
     Serial.printf("Chip Model: %s\n", ESP.getChipModel());
     Serial.printf("Chip Revision: %d\n", ESP.getChipRevision());
     Serial.printf("CPU Frequency: %d MHz\n", ESP.getCpuFreqMHz());
@@ -253,5 +537,5 @@ void printSystemInfo() {
     Serial.printf("Configuration Status: %s\n", configManager.isConfigured() ? "Configured" : "Not Configured");
     Serial.printf("Display Status: Initialized");
     Serial.printf("Operating Mode: %s\n", isConfigMode ? "Configuration" : "Normal");
-    Serial.println(repeat("=", 50));
+    Serial.println(BANNER_RULE);
 }
\ No newline at end of file
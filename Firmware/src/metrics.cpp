@@ -0,0 +1,99 @@
+#include "metrics.h"
+
+#if METRICS_ENABLED
+
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+#define METRICS_MAGIC 0x4D455431  // "MET1" - bump when the layout changes
+
+struct MetricsState {
+    uint32_t magic;
+    MetricStats phases[METRIC_PHASE_COUNT];
+    uint32_t downloadBytes;       // Size of the last completed download
+};
+
+static RTC_DATA_ATTR MetricsState metricsState;
+static uint32_t phaseStart[METRIC_PHASE_COUNT];
+
+static const char* const phaseNames[METRIC_PHASE_COUNT] = {
+    "wifi", "tls", "ttfb", "download", "spi", "busy_on", "busy_refresh", "busy_off", "awake"
+};
+
+void metricsBegin(bool restored) {
+    if (!restored || metricsState.magic != METRICS_MAGIC) {
+        memset(&metricsState, 0, sizeof(metricsState));
+        metricsState.magic = METRICS_MAGIC;
+    }
+    memset(phaseStart, 0, sizeof(phaseStart));
+}
+
+void metricsStart(MetricPhase phase) {
+    phaseStart[phase] = METRIC_NOW();
+}
+
+void metricsStop(MetricPhase phase) {
+    metricsRecord(phase, METRIC_NOW() - phaseStart[phase]);
+}
+
+void metricsRecord(MetricPhase phase, uint32_t micros) {
+    MetricStats& stats = metricsState.phases[phase];
+    
+    if (stats.count == 0) {
+        stats.minUs = micros;
+        stats.maxUs = micros;
+        stats.avgUs = micros;
+    } else {
+        stats.minUs = min(stats.minUs, micros);
+        stats.maxUs = max(stats.maxUs, micros);
+        stats.avgUs = (uint32_t)((int32_t)stats.avgUs + 
+                                 (((int32_t)micros - (int32_t)stats.avgUs) >> METRICS_AVERAGE_SHIFT));
+    }
+    stats.lastUs = micros;
+    stats.count++;
+}
+
+void metricsSetDownloadBytes(uint32_t bytes) {
+    metricsState.downloadBytes = bytes;
+}
+
+uint32_t metricsGetDownloadBytes() {
+    return metricsState.downloadBytes;
+}
+
+const MetricStats& metricsGet(MetricPhase phase) {
+    return metricsState.phases[phase];
+}
+
+static uint32_t downloadKBps() {
+    uint32_t micros = metricsState.phases[METRIC_DOWNLOAD].lastUs;
+    return micros > 0 ? (uint32_t)((uint64_t)metricsState.downloadBytes * 1000 / micros) : 0;
+}
+
+void metricsPrint() {
+    // One line, last sample of each phase in ms, for grepping serial logs
+    Serial.print("METRICS");
+    for (int i = 0; i < METRIC_PHASE_COUNT; i++) {
+        const MetricStats& stats = metricsState.phases[i];
+        if (stats.count == 0) continue;
+        Serial.printf(" %s=%lu", phaseNames[i], (unsigned long)(stats.lastUs / 1000));
+    }
+    Serial.printf(" bytes=%lu kBps=%lu\n", (unsigned long)metricsState.downloadBytes, 
+                  (unsigned long)downloadKBps());
+}
+
+void metricsToJson(JsonObject obj) {
+    for (int i = 0; i < METRIC_PHASE_COUNT; i++) {
+        const MetricStats& stats = metricsState.phases[i];
+        JsonObject phase = obj[phaseNames[i]].to<JsonObject>();
+        phase["last_us"] = stats.lastUs;
+        phase["min_us"] = stats.minUs;
+        phase["avg_us"] = stats.avgUs;
+        phase["max_us"] = stats.maxUs;
+        phase["count"] = stats.count;
+    }
+    obj["download_bytes"] = metricsState.downloadBytes;
+    obj["download_kBps"] = downloadKBps();
+}
+
+#endif // METRICS_ENABLED
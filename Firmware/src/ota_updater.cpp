@@ -0,0 +1,337 @@
+#include "ota_updater.h"
+#include "github_fetcher.h"
+#include "rtc_state.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+#include <Update.h>
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include <time.h>
+
+// Same ROM inflater as the zlib frame codec
+#if CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/miniz.h"
+#elif CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#else
+#include "esp32/rom/miniz.h"
+#endif
+
+struct OtaInflateState {
+    tinfl_decompressor inflator;
+    mbedtls_sha256_context sha;
+    uint8_t window[OTA_INFLATE_WINDOW];
+};
+
+static_assert(sizeof(OtaInflateState) <= DISPLAY_FRAME_SIZE, "Inflater must fit an arena slot");
+
+// The Arduino core would otherwise accept a freshly installed image before
+// setup() runs; confirm() decides instead
+extern "C" bool verifyRollbackLater() {
+    return true;
+}
+
+OtaUpdater::OtaUpdater() :
+    frameArena(nullptr), trial(false), inflate(nullptr), inflateBuffer(nullptr), windowPos(0),
+    compressedRead(0), imageWritten(0), inflateDone(false), failed(false) {
+    memset(&manifest, 0, sizeof(manifest));
+}
+
+OtaUpdater::~OtaUpdater() {
+    releaseInflate();
+}
+
+void OtaUpdater::begin(bool coldBoot) {
+    prefs.begin(OTA_NVS_NAMESPACE, true);
+    uint32_t pending = prefs.getUInt("pending", 0);
+    uint32_t boots = prefs.getUInt("boots", 0);
+    prefs.end();
+    
+    if (pending == 0) {
+        return;
+    }
+    
+    if (pending != FIRMWARE_BUILD) {
+        // The bootloader already fell back to this image
+        Serial.printf("Firmware build %lu did not start - staying on build %d\n", 
+                      (unsigned long)pending, FIRMWARE_BUILD);
+        prefs.begin(OTA_NVS_NAMESPACE, false);
+        prefs.putUInt("failed", pending);
+        clearTrial();
+        prefs.end();
+        return;
+    }
+    
+    trial = true;
+    // A timer wake means the last start got as far as sleeping; anything
+    // else (restart, panic, watchdog) starts the count again
+    if (!coldBoot) {
+        return;
+    }
+    
+    // The stock S2 bootloader has no app rollback, so a crashing image
+    // would otherwise boot itself on trial forever
+    boots++;
+    if (boots > OTA_TRIAL_BOOTS) {
+        rollBack("restarted before an update cycle", true);
+        return;
+    }
+    prefs.begin(OTA_NVS_NAMESPACE, false);
+    prefs.putUInt("boots", boots);
+    prefs.end();
+    Serial.printf("Running firmware build %d on trial (start %lu of %d)\n", 
+                  FIRMWARE_BUILD, (unsigned long)boots, OTA_TRIAL_BOOTS);
+}
+
+void OtaUpdater::confirm(bool healthy) {
+    if (!trial) {
+        return;
+    }
+    
+    if (healthy) {
+        esp_ota_mark_app_valid_cancel_rollback();
+        prefs.begin(OTA_NVS_NAMESPACE, false);
+        clearTrial();
+        prefs.end();
+        trial = false;
+        Serial.printf("Firmware build %d confirmed\n", FIRMWARE_BUILD);
+        return;
+    }
+    
+    // Servers and access points fail too; only a run of failures says
+    // anything about the image, and even then it is not blacklisted
+    prefs.begin(OTA_NVS_NAMESPACE, false);
+    uint32_t cycles = prefs.getUInt("cycles", 0) + 1;
+    prefs.putUInt("cycles", cycles);
+    prefs.putUInt("boots", 0);
+    prefs.end();
+    Serial.printf("Firmware build %d on trial: update cycle failed (%lu of %d)\n",
+                  FIRMWARE_BUILD, (unsigned long)cycles, OTA_TRIAL_CYCLES);
+    if (cycles >= OTA_TRIAL_CYCLES) {
+        rollBack("failed every update cycle", false);
+    }
+}
+
+void OtaUpdater::clearTrial() {
+    prefs.remove("pending");
+    prefs.remove("boots");
+    prefs.remove("cycles");
+}
+
+void OtaUpdater::rollBack(const char* reason, bool blacklist) {
+    Serial.printf("Firmware build %d %s - rolling back\n", FIRMWARE_BUILD, reason);
+    prefs.begin(OTA_NVS_NAMESPACE, false);
+    if (blacklist) {
+        prefs.putUInt("failed", FIRMWARE_BUILD);
+    }
+    clearTrial();
+    prefs.end();
+    Serial.flush();
+    
+    // Only returns when the bootloader has no rollback support; the other
+    // OTA partition still holds the previous image, so boot it directly
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+    const esp_partition_t* previous = esp_ota_get_next_update_partition(nullptr);
+    if (previous && esp_ota_set_boot_partition(previous) == ESP_OK) {
+        ESP.restart();
+    }
+    Serial.println("No previous firmware to roll back to");
+    trial = false;
+}
+
+bool OtaUpdater::checkDue() const {
+    // Without a clock only cold boots check
+    time_t now = time(nullptr);
+    if (now < (time_t)MIN_VALID_EPOCH) {
+        return rtcState.lastOtaCheckEpoch == 0;
+    }
+    return rtcState.lastOtaCheckEpoch == 0 ||
+           (uint32_t)now - rtcState.lastOtaCheckEpoch >= OTA_CHECK_INTERVAL_S;
+}
+
+bool OtaUpdater::fetchManifest(GitHubImageFetcher& fetcher) {
+    JsonDocument doc;
+    if (!fetcher.fetchRepoJson(OTA_MANIFEST_PATH, doc)) {
+        return false;
+    }
+    
+    const char* sha = doc["sha256"] | "";
+    const char* file = doc["file"] | "";
+    manifest.build = doc["build"] | 0;
+    manifest.size = doc["size"] | 0;
+    manifest.imageSize = doc["image_size"] | 0;
+    
+    if (strlen(sha) != OTA_SHA256_LENGTH * 2 || strlen(file) == 0 || strlen(file) > MAX_PATH_LENGTH ||
+        manifest.size == 0 || manifest.imageSize == 0 || manifest.imageSize > OTA_MAX_IMAGE_SIZE) {
+        Serial.println("Firmware manifest incomplete - ignoring it");
+        return false;
+    }
+    
+    for (int i = 0; i < OTA_SHA256_LENGTH; i++) {
+        char hex[3] = { sha[i * 2], sha[i * 2 + 1], '\0' };
+        manifest.sha256[i] = (uint8_t)strtoul(hex, nullptr, 16);
+    }
+    strncpy(manifest.file, file, MAX_PATH_LENGTH);
+    manifest.file[MAX_PATH_LENGTH] = '\0';
+    return true;
+}
+
+bool OtaUpdater::install(GitHubImageFetcher& fetcher) {
+    if (time(nullptr) >= (time_t)MIN_VALID_EPOCH) {
+        rtcState.lastOtaCheckEpoch = (uint32_t)time(nullptr);
+    } else {
+        rtcState.lastOtaCheckEpoch = 1;  // Checked this boot
+    }
+    
+    Serial.println("Checking for firmware updates...");
+    if (!fetchManifest(fetcher)) {
+        return false;
+    }
+    
+    prefs.begin(OTA_NVS_NAMESPACE, true);
+    uint32_t failedBuild = prefs.getUInt("failed", 0);
+    prefs.end();
+    
+    if (manifest.build <= FIRMWARE_BUILD || manifest.build == failedBuild) {
+        Serial.printf("Firmware is current (build %d, published %lu)\n", 
+                      FIRMWARE_BUILD, (unsigned long)manifest.build);
+        return false;
+    }
+    
+    Serial.printf("Installing firmware build %lu: %lu bytes, %lu compressed\n",
+                  (unsigned long)manifest.build, (unsigned long)manifest.imageSize, (unsigned long)manifest.size);
+    if (!fetcher.streamRepoFile(manifest.file, this, manifest.size)) {
+        Serial.println("Firmware update failed - keeping the running image");
+        return false;
+    }
+    
+    prefs.begin(OTA_NVS_NAMESPACE, false);
+    clearTrial();
+    prefs.putUInt("pending", manifest.build);
+    prefs.end();
+    Serial.printf("Firmware build %lu installed\n", (unsigned long)manifest.build);
+    return true;
+}
+
+bool OtaUpdater::beginFrame(size_t frameSize) {
+    if (frameSize != manifest.size) {
+        Serial.printf("Firmware size %u does not match the manifest (%lu)\n", 
+                      (unsigned)frameSize, (unsigned long)manifest.size);
+        return false;
+    }
+    
+    // 43 KB of inflater and window; a frame slot is free once the panel is done
+    inflateBuffer = frameArena ? frameArena->acquire("ota") : nullptr;
+    if (!inflateBuffer) {
+        Serial.println("No buffer for the firmware inflater");
+        return false;
+    }
+    inflate = (OtaInflateState*)inflateBuffer;
+    
+    if (!Update.begin(manifest.imageSize, U_FLASH)) {
+        Serial.printf("Cannot start firmware update: %s\n", Update.errorString());
+        releaseInflate();
+        return false;
+    }
+    
+    tinfl_init(&inflate->inflator);
+    mbedtls_sha256_init(&inflate->sha);
+    mbedtls_sha256_starts(&inflate->sha, 0);
+    windowPos = 0;
+    compressedRead = 0;
+    imageWritten = 0;
+    inflateDone = false;
+    failed = false;
+    return true;
+}
+
+bool OtaUpdater::writeFrame(const uint8_t* data, size_t length) {
+    if (failed || !inflate) {
+        return false;
+    }
+    compressedRead += length;
+    failed = !inflateChunk(data, length);
+    return !failed;
+}
+
+bool OtaUpdater::inflateChunk(const uint8_t* data, size_t length) {
+    while (!inflateDone) {
+        size_t inBytes = length;
+        size_t outBytes = OTA_INFLATE_WINDOW - windowPos;
+        mz_uint32 flags = TINFL_FLAG_PARSE_ZLIB_HEADER;
+        if (compressedRead < manifest.size) {
+            flags |= TINFL_FLAG_HAS_MORE_INPUT;
+        }
+        
+        tinfl_status status = tinfl_decompress(&inflate->inflator, data, &inBytes,
+                                               inflate->window, inflate->window + windowPos,
+                                               &outBytes, flags);
+        data += inBytes;
+        length -= inBytes;
+        
+        if (outBytes > 0 && !writeImage(inflate->window + windowPos, outBytes)) {
+            return false;
+        }
+        windowPos = (windowPos + outBytes) & (OTA_INFLATE_WINDOW - 1);
+        
+        if (status == TINFL_STATUS_DONE) {
+            inflateDone = true;
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT) {
+            if (length == 0) break;
+        } else if (status != TINFL_STATUS_HAS_MORE_OUTPUT) {
+            Serial.printf("Firmware inflate failed with status %d\n", status);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OtaUpdater::writeImage(const uint8_t* data, size_t length) {
+    if (length > manifest.imageSize - imageWritten) {
+        Serial.println("Firmware decodes past the declared size");
+        return false;
+    }
+    
+    mbedtls_sha256_update(&inflate->sha, data, length);
+    if (Update.write((uint8_t*)data, length) != length) {
+        Serial.printf("Firmware write failed: %s\n", Update.errorString());
+        return false;
+    }
+    imageWritten += length;
+    return true;
+}
+
+bool OtaUpdater::endFrame(bool commit) {
+    if (!inflate) {
+        return false;
+    }
+    
+    uint8_t digest[OTA_SHA256_LENGTH];
+    mbedtls_sha256_finish(&inflate->sha, digest);
+    mbedtls_sha256_free(&inflate->sha);
+    
+    bool complete = commit && !failed && inflateDone && imageWritten == manifest.imageSize;
+    bool verified = complete && memcmp(digest, manifest.sha256, sizeof(digest)) == 0;
+    releaseInflate();
+    
+    if (!verified) {
+        Serial.printf("Firmware %s - discarding it\n", complete ? "SHA-256 mismatch" : "incomplete");
+        Update.abort();
+        return false;
+    }
+    
+    // Validates the image header and makes the new partition bootable
+    if (!Update.end()) {
+        Serial.printf("Cannot finish firmware update: %s\n", Update.errorString());
+        return false;
+    }
+    return true;
+}
+
+void OtaUpdater::releaseInflate() {
+    if (inflateBuffer && frameArena) {
+        frameArena->release(inflateBuffer);
+    }
+    inflateBuffer = nullptr;
+    inflate = nullptr;
+}
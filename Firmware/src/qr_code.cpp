@@ -1,157 +1,530 @@
 #include "qr_code.h"
+#include "epd7in3f.h"
+#include "config.h"
 #include <string.h>
 
-QRCode::QRCode() {
+// GF(256) with the QR polynomial x^8 + x^4 + x^3 + x^2 + 1, built by the
+// compiler so the tables live in flash
+struct GaloisTables {
+    uint8_t exp[256];
+    uint8_t log[256];
+};
+
+static constexpr GaloisTables makeGaloisTables() {
+    GaloisTables tables = {};
+    int value = 1;
+    for (int i = 0; i < 255; i++) {
+        tables.exp[i] = value;
+        tables.log[value] = i;
+        value <<= 1;
+        if (value & 0x100) {
+            value ^= 0x11D;
+        }
+    }
+    tables.exp[255] = tables.exp[0];
+    return tables;
 }
 
-QRCode::~QRCode() {
+static constexpr GaloisTables GF = makeGaloisTables();
+static_assert(GF.exp[8] == 0x1D && GF.log[0x1D] == 8, "GF(256) tables");
+
+// Level M, indexed by version
+static constexpr uint8_t ECC_CODEWORDS_PER_BLOCK[QR_MAX_VERSION + 1] = {0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26};
+static constexpr uint8_t ECC_BLOCKS[QR_MAX_VERSION + 1] = {0, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5};
+#define QR_ECC_FORMAT_BITS 0  // Level M
+#define QR_MAX_CODEWORDS   346  // Version 10
+#define QR_MAX_ECC_DEGREE  26
+#define QR_MAX_BLOCKS      5
+
+static constexpr int rawDataModules(int version) {
+    int result = (16 * version + 128) * version + 64;
+    if (version >= 2) {
+        int alignments = version / 7 + 2;
+        result -= (25 * alignments - 10) * alignments - 55;
+        if (version >= 7) {
+            result -= 36;
+        }
+    }
+    return result;
 }
 
-void QRCode::generateWiFiQR(const char* ssid, const char* password, uint8_t* qrData, int size) {
-    // Create WiFi QR code content
-    char wifiString[256];
-    snprintf(wifiString, sizeof(wifiString), "WIFI:T:WPA;S:%s;P:%s;H:false;;", ssid, password);
-    
-    generateSimpleQR(wifiString, qrData, size);
+static_assert(rawDataModules(QR_MAX_VERSION) / 8 == QR_MAX_CODEWORDS, "Codeword buffer size");
+
+static constexpr int dataCodewords(int version) {
+    return rawDataModules(version) / 8 - ECC_CODEWORDS_PER_BLOCK[version] * ECC_BLOCKS[version];
 }
 
-void QRCode::generateUrlQR(const char* url, uint8_t* qrData, int size) {
-    generateSimpleQR(url, qrData, size);
+static uint8_t gfMultiply(uint8_t a, uint8_t b) {
+    return (a && b) ? GF.exp[(GF.log[a] + GF.log[b]) % 255] : 0;
 }
 
-void QRCode::generateSimpleQR(const char* text, uint8_t* qrData, int size) {
-    // Clear the QR code data
-    memset(qrData, 0, size * size);
+static void reedSolomonGenerator(int degree, uint8_t* generator) {
+    memset(generator, 0, degree);
+    generator[degree - 1] = 1;
+    uint8_t root = 1;
+    for (int i = 0; i < degree; i++) {
+        for (int j = 0; j < degree; j++) {
+            generator[j] = gfMultiply(generator[j], root);
+            if (j + 1 < degree) {
+                generator[j] ^= generator[j + 1];
+            }
+        }
+        root = gfMultiply(root, 0x02);
+    }
+}
+
+static void reedSolomonRemainder(const uint8_t* data, int length, const uint8_t* generator,
+                                 int degree, uint8_t* remainder) {
+    memset(remainder, 0, degree);
+    for (int i = 0; i < length; i++) {
+        uint8_t factor = data[i] ^ remainder[0];
+        memmove(remainder, remainder + 1, degree - 1);
+        remainder[degree - 1] = 0;
+        for (int j = 0; j < degree; j++) {
+            remainder[j] ^= gfMultiply(generator[j], factor);
+        }
+    }
+}
+
+// Module grid while it is built: bit 0 dark, bit 1 function pattern
+#define MODULE_DARK     0x01
+#define MODULE_FUNCTION 0x02
+
+struct QRMatrix {
+    uint8_t* modules;
+    int size;
     
-    // For simplicity, create a basic pattern that looks like a QR code
-    // This is a simplified version - a full QR implementation would be much more complex
+    bool isDark(int x, int y) const { return modules[y * size + x] & MODULE_DARK; }
+    bool isFunction(int x, int y) const { return modules[y * size + x] & MODULE_FUNCTION; }
+    void setFunction(int x, int y, bool dark) {
+        modules[y * size + x] = MODULE_FUNCTION | (dark ? MODULE_DARK : 0);
+    }
     
-    // Add finder patterns (corners)
-    createFinderPattern(qrData, size, 0, 0);           // Top-left
-    createFinderPattern(qrData, size, size-7, 0);      // Top-right
-    createFinderPattern(qrData, size, 0, size-7);      // Bottom-left
+    void drawFinder(int cx, int cy) {
+        for (int dy = -4; dy <= 4; dy++) {
+            for (int dx = -4; dx <= 4; dx++) {
+                int x = cx + dx;
+                int y = cy + dy;
+                if (x < 0 || x >= size || y < 0 || y >= size) continue;
+                int distance = max(abs(dx), abs(dy));
+                setFunction(x, y, distance != 2 && distance != 4);
+            }
+        }
+    }
     
-    // Add timing patterns
-    createTimingPattern(qrData, size);
+    void drawAlignment(int cx, int cy) {
+        for (int dy = -2; dy <= 2; dy++) {
+            for (int dx = -2; dx <= 2; dx++) {
+                setFunction(cx + dx, cy + dy, max(abs(dx), abs(dy)) != 1);
+            }
+        }
+    }
     
-    // Add some data pattern based on text hash
-    unsigned int hash = 0;
-    for (int i = 0; text[i] != 0; i++) {
-        hash = hash * 31 + text[i];
+    void drawFormat(int mask) {
+        int data = QR_ECC_FORMAT_BITS << 3 | mask;
+        int remainder = data;
+        for (int i = 0; i < 10; i++) {
+            remainder = (remainder << 1) ^ ((remainder >> 9) * 0x537);
+        }
+        int bits = (data << 10 | remainder) ^ 0x5412;
+        
+        // Around the top-left finder
+        for (int i = 0; i <= 5; i++) {
+            setFunction(8, i, (bits >> i) & 1);
+        }
+        setFunction(8, 7, (bits >> 6) & 1);
+        setFunction(8, 8, (bits >> 7) & 1);
+        setFunction(7, 8, (bits >> 8) & 1);
+        for (int i = 9; i < 15; i++) {
+            setFunction(14 - i, 8, (bits >> i) & 1);
+        }
+        
+        // Split between the other two finders
+        for (int i = 0; i < 8; i++) {
+            setFunction(size - 1 - i, 8, (bits >> i) & 1);
+        }
+        for (int i = 8; i < 15; i++) {
+            setFunction(8, size - 15 + i, (bits >> i) & 1);
+        }
+        setFunction(8, size - 8, true);
     }
     
-    // Fill center area with pseudo-random pattern based on text
-    for (int y = 9; y < size - 9; y++) {
-        for (int x = 9; x < size - 9; x++) {
-            // Skip timing patterns
-            if (x == 6 || y == 6) continue;
-            
-            // Create pattern based on position and text hash
-            unsigned int pattern = (x * 7 + y * 11 + hash) % 3;
-            if (pattern == 0) {
-                qrData[y * size + x] = 1;
+    void drawVersion(int version) {
+        if (version < 7) return;
+        int remainder = version;
+        for (int i = 0; i < 12; i++) {
+            remainder = (remainder << 1) ^ ((remainder >> 11) * 0x1F25);
+        }
+        long bits = (long)version << 12 | remainder;
+        for (int i = 0; i < 18; i++) {
+            bool dark = (bits >> i) & 1;
+            int a = size - 11 + i % 3;
+            int b = i / 3;
+            setFunction(a, b, dark);
+            setFunction(b, a, dark);
+        }
+    }
+    
+    void drawFunctionPatterns(int version) {
+        for (int i = 0; i < size; i++) {
+            setFunction(6, i, i % 2 == 0);
+            setFunction(i, 6, i % 2 == 0);
+        }
+        drawFinder(3, 3);
+        drawFinder(size - 4, 3);
+        drawFinder(3, size - 4);
+        
+        if (version >= 2) {
+            int count = version / 7 + 2;
+            int step = (version * 4 + count * 2 + 1) / (count * 2 - 2) * 2;
+            int positions[QR_MAX_VERSION / 7 + 2];
+            positions[0] = 6;
+            for (int i = count - 1, position = size - 7; i >= 1; i--, position -= step) {
+                positions[i] = position;
+            }
+            for (int i = 0; i < count; i++) {
+                for (int j = 0; j < count; j++) {
+                    // Not over the finders
+                    if ((i == 0 && j == 0) || (i == 0 && j == count - 1) || (i == count - 1 && j == 0)) continue;
+                    drawAlignment(positions[i], positions[j]);
+                }
             }
         }
+        
+        // Reserved until the mask is chosen
+        drawFormat(0);
+        drawVersion(version);
     }
     
-    // Add quiet zone
-    addQuietZone(qrData, size);
-}
-
-void QRCode::createFinderPattern(uint8_t* data, int size, int x, int y) {
-    // 7x7 finder pattern
-    for (int dy = 0; dy < 7; dy++) {
-        for (int dx = 0; dx < 7; dx++) {
-            if (x + dx >= size || y + dy >= size) continue;
-            
-            // Outer border (7x7)
-            if (dx == 0 || dx == 6 || dy == 0 || dy == 6) {
-                data[(y + dy) * size + (x + dx)] = 1;
+    void drawCodewords(const uint8_t* codewords, int length) {
+        int bit = 0;
+        for (int right = size - 1; right >= 1; right -= 2) {
+            if (right == 6) {
+                right = 5;  // Skip the vertical timing pattern
             }
-            // Inner square (3x3 in center)
-            else if (dx >= 2 && dx <= 4 && dy >= 2 && dy <= 4) {
-                data[(y + dy) * size + (x + dx)] = 1;
+            for (int vertical = 0; vertical < size; vertical++) {
+                for (int j = 0; j < 2; j++) {
+                    int x = right - j;
+                    bool upward = ((right + 1) & 2) == 0;
+                    int y = upward ? size - 1 - vertical : vertical;
+                    if (isFunction(x, y) || bit >= length * 8) continue;
+                    if ((codewords[bit >> 3] >> (7 - (bit & 7))) & 1) {
+                        modules[y * size + x] = MODULE_DARK;
+                    }
+                    bit++;
+                }
             }
-            // White area between outer and inner
-            else {
-                data[(y + dy) * size + (x + dx)] = 0;
+        }
+    }
+    
+    void applyMask(int mask) {
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                bool invert;
+                switch (mask) {
+                    case 0:  invert = (x + y) % 2 == 0; break;
+                    case 1:  invert = y % 2 == 0; break;
+                    case 2:  invert = x % 3 == 0; break;
+                    case 3:  invert = (x + y) % 3 == 0; break;
+                    case 4:  invert = (x / 3 + y / 2) % 2 == 0; break;
+                    case 5:  invert = x * y % 2 + x * y % 3 == 0; break;
+                    case 6:  invert = (x * y % 2 + x * y % 3) % 2 == 0; break;
+                    default: invert = ((x + y) % 2 + x * y % 3) % 2 == 0; break;
+                }
+                if (invert && !isFunction(x, y)) {
+                    modules[y * size + x] ^= MODULE_DARK;
+                }
             }
         }
     }
-}
+    
+    // Dark module along a row (horizontal) or column
+    bool line(bool horizontal, int line, int i) const {
+        return horizontal ? isDark(i, line) : isDark(line, i);
+    }
+    
+    long penalty() const {
+        long score = 0;
+        
+        // Runs of five or more, and finder-like 1:1:3:1:1 patterns with
+        // four light modules on one side
+        for (int pass = 0; pass < 2; pass++) {
+            bool horizontal = pass == 0;
+            for (int l = 0; l < size; l++) {
+                int run = 0;
+                bool previous = false;
+                for (int i = 0; i < size; i++) {
+                    bool dark = line(horizontal, l, i);
+                    if (i > 0 && dark == previous) {
+                        run++;
+                        if (run == 5) score += 3;
+                        else if (run > 5) score++;
+                    } else {
+                        run = 1;
+                        previous = dark;
+                    }
+                    
+                    if (i + 7 <= size && dark && !line(horizontal, l, i + 1) && line(horizontal, l, i + 2) &&
+                        line(horizontal, l, i + 3) && line(horizontal, l, i + 4) &&
+                        !line(horizontal, l, i + 5) && line(horizontal, l, i + 6)) {
+                        bool lightBefore = true;
+                        bool lightAfter = true;
+                        for (int k = 1; k <= 4; k++) {
+                            if (i - k >= 0 && line(horizontal, l, i - k)) lightBefore = false;
+                            if (i + 6 + k < size && line(horizontal, l, i + 6 + k)) lightAfter = false;
+                        }
+                        if (lightBefore || lightAfter) score += 40;
+                    }
+                }
+            }
+        }
+        
+        // 2x2 blocks of one colour
+        int dark = 0;
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                bool color = isDark(x, y);
+                if (color) dark++;
+                if (x + 1 < size && y + 1 < size && color == isDark(x + 1, y) &&
+                    color == isDark(x, y + 1) && color == isDark(x + 1, y + 1)) {
+                    score += 3;
+                }
+            }
+        }
+        
+        // Balance of dark and light, in steps of 5%
+        int total = size * size;
+        int deviation = abs(dark * 20 - total * 10);
+        score += (long)((deviation + total - 1) / total - 1) * 10;
+        return score;
+    }
+};
 
-void QRCode::createTimingPattern(uint8_t* data, int size) {
-    // Horizontal timing pattern (row 6)
-    for (int x = 8; x < size - 8; x++) {
-        if (6 < size) {
-            data[6 * size + x] = (x % 2 == 0) ? 1 : 0;
+int QRCode::encode(const char* text, uint8_t* modules) {
+    int length = strlen(text);
+    
+    int version = 1;
+    while (version <= QR_MAX_VERSION && 4 + (version < 10 ? 8 : 16) + length * 8 > dataCodewords(version) * 8) {
+        version++;
+    }
+    if (version > QR_MAX_VERSION) {
+        Serial.printf("QR code: %d bytes do not fit version %d\n", length, QR_MAX_VERSION);
+        return 0;
+    }
+    
+    // Byte mode segment, terminator and padding
+    uint8_t data[QR_MAX_CODEWORDS] = {0};
+    int capacity = dataCodewords(version);
+    int bits = 0;
+    auto append = [&](uint32_t value, int count) {
+        for (int i = count - 1; i >= 0; i--, bits++) {
+            data[bits >> 3] |= ((value >> i) & 1) << (7 - (bits & 7));
+        }
+    };
+    append(0x4, 4);
+    append(length, version < 10 ? 8 : 16);
+    for (int i = 0; i < length; i++) {
+        append((uint8_t)text[i], 8);
+    }
+    append(0, min(4, capacity * 8 - bits));
+    bits = (bits + 7) & ~7;
+    for (uint8_t pad = 0xEC; bits < capacity * 8; pad ^= 0xEC ^ 0x11) {
+        append(pad, 8);
+    }
+    
+    // Split into blocks, the long ones last, and interleave them with
+    // their error correction codewords
+    int blocks = ECC_BLOCKS[version];
+    int degree = ECC_CODEWORDS_PER_BLOCK[version];
+    int rawCodewords = rawDataModules(version) / 8;
+    int shortBlocks = blocks - rawCodewords % blocks;
+    int shortLength = rawCodewords / blocks - degree;
+    
+    uint8_t generator[QR_MAX_ECC_DEGREE];
+    uint8_t ecc[QR_MAX_BLOCKS][QR_MAX_ECC_DEGREE];
+    reedSolomonGenerator(degree, generator);
+    const uint8_t* blockData[QR_MAX_BLOCKS];
+    for (int b = 0, offset = 0; b < blocks; b++) {
+        int blockLength = shortLength + (b >= shortBlocks ? 1 : 0);
+        blockData[b] = data + offset;
+        reedSolomonRemainder(data + offset, blockLength, generator, degree, ecc[b]);
+        offset += blockLength;
+    }
+    
+    uint8_t codewords[QR_MAX_CODEWORDS];
+    int count = 0;
+    for (int i = 0; i <= shortLength; i++) {
+        for (int b = 0; b < blocks; b++) {
+            if (i < shortLength || b >= shortBlocks) {
+                codewords[count++] = blockData[b][i];
+            }
+        }
+    }
+    for (int i = 0; i < degree; i++) {
+        for (int b = 0; b < blocks; b++) {
+            codewords[count++] = ecc[b][i];
         }
     }
     
-    // Vertical timing pattern (column 6)
-    for (int y = 8; y < size - 8; y++) {
-        if (6 < size) {
-            data[y * size + 6] = (y % 2 == 0) ? 1 : 0;
+    QRMatrix matrix = { modules, version * 4 + 17 };
+    memset(modules, 0, matrix.size * matrix.size);
+    matrix.drawFunctionPatterns(version);
+    matrix.drawCodewords(codewords, count);
+    
+    // Each mask is applied, scored and undone again
+    int bestMask = 0;
+    long bestPenalty = -1;
+    for (int mask = 0; mask < 8; mask++) {
+        matrix.applyMask(mask);
+        matrix.drawFormat(mask);
+        long penalty = matrix.penalty();
+        if (bestPenalty < 0 || penalty < bestPenalty) {
+            bestMask = mask;
+            bestPenalty = penalty;
         }
+        matrix.applyMask(mask);
+    }
+    matrix.applyMask(bestMask);
+    matrix.drawFormat(bestMask);
+    
+    for (int i = 0; i < matrix.size * matrix.size; i++) {
+        modules[i] &= MODULE_DARK;
     }
+    return matrix.size;
 }
 
-void QRCode::addQuietZone(uint8_t* data, int size) {
-    // Add 4-module quiet zone around the QR code
-    // For simplicity, we just ensure the border is clear
-    for (int i = 0; i < size; i++) {
-        data[0 * size + i] = 0;  // Top border
-        data[(size-1) * size + i] = 0;  // Bottom border
-        data[i * size + 0] = 0;  // Left border
-        data[i * size + (size-1)] = 0;  // Right border
+// Backslash before the characters the WIFI: syntax reserves; false when
+// the text does not fit
+static bool appendEscaped(char*& out, const char* end, const char* text) {
+    for (; *text; text++) {
+        bool reserved = strchr("\\;,:\"", *text) != nullptr;
+        if (out + (reserved ? 2 : 1) > end) {
+            return false;
+        }
+        if (reserved) {
+            *out++ = '\\';
+        }
+        *out++ = *text;
     }
+    return true;
 }
 
-void QRCode::convertToEPaperFormat(const uint8_t* qrData, int qrSize, 
-                                  uint8_t* epaperData, int centerX, int centerY, int scale) {
-    // Clear the e-paper data area first
-    for (int y = centerY - (qrSize * scale) / 2; y < centerY + (qrSize * scale) / 2; y++) {
-        for (int x = centerX - (qrSize * scale) / 2; x < centerX + (qrSize * scale) / 2; x++) {
-            if (x >= 0 && x < 800 && y >= 0 && y < 480) {
-                // Calculate position in e-paper buffer (2 pixels per byte)
-                int bufferIndex = (y * 400) + (x / 2);  // 800 pixels / 2 = 400 bytes per row
-                
-                if (x % 2 == 0) {
-                    // Left pixel (upper 4 bits)
-                    epaperData[bufferIndex] = (epaperData[bufferIndex] & 0x0F) | (0x10);  // White
-                } else {
-                    // Right pixel (lower 4 bits)
-                    epaperData[bufferIndex] = (epaperData[bufferIndex] & 0xF0) | 0x01;   // White
-                }
-            }
-        }
+// Every character of a maximum-length SSID and password escaped
+#define WIFI_QR_MAX_LENGTH (13 + 2 * MAX_SSID_LENGTH + 3 + 2 * MAX_PASSWORD_LENGTH + 2)
+
+int QRCode::generateWiFiQR(const char* ssid, const char* password, uint8_t* modules) {
+    char wifiString[WIFI_QR_MAX_LENGTH + 1];
+    char* out = wifiString;
+    const char* end = wifiString + sizeof(wifiString) - 3;  // Room for ";;" and the terminator
+    
+    strcpy(out, "WIFI:T:WPA;S:");
+    out += strlen(out);
+    bool fits = appendEscaped(out, end - 3, ssid);
+    strcpy(out, ";P:");
+    out += strlen(out);
+    fits = fits && appendEscaped(out, end, password);
+    strcpy(out, ";;");
+    
+    // A cut-off credential would still scan, so show nothing instead
+    if (!fits) {
+        Serial.println("QR code: WiFi credentials too long");
+        return 0;
     }
+    return encode(wifiString, modules);
+}
+
+int QRCode::generateUrlQR(const char* url, uint8_t* modules) {
+    return encode(url, modules);
+}
+
+void QRCode::convertToEPaperFormat(const uint8_t* qrData, int qrSize,
+                                  Canvas& canvas, int centerX, int centerY, int scale) {
+    int left = centerX - (qrSize * scale) / 2;
+    int top = centerY - (qrSize * scale) / 2;
+    
+    // White background under the whole code
+    canvas.fillRect(left, top, qrSize * scale, qrSize * scale, EPD_7IN3F_WHITE);
     
-    // Draw the QR code
+    // Each horizontal run of dark modules is a single rectangle
     for (int qrY = 0; qrY < qrSize; qrY++) {
-        for (int qrX = 0; qrX < qrSize; qrX++) {
-            if (qrData[qrY * qrSize + qrX] == 1) {  // Black module
-                // Scale up the QR code
-                for (int sy = 0; sy < scale; sy++) {
-                    for (int sx = 0; sx < scale; sx++) {
-                        int displayX = centerX - (qrSize * scale) / 2 + qrX * scale + sx;
-                        int displayY = centerY - (qrSize * scale) / 2 + qrY * scale + sy;
-                        
-                        if (displayX >= 0 && displayX < 800 && displayY >= 0 && displayY < 480) {
-                            // Calculate position in e-paper buffer
-                            int bufferIndex = (displayY * 400) + (displayX / 2);
-                            
-                            if (displayX % 2 == 0) {
-                                // Left pixel (upper 4 bits)
-                                epaperData[bufferIndex] = (epaperData[bufferIndex] & 0x0F) | (0x00);  // Black
-                            } else {
-                                // Right pixel (lower 4 bits)
-                                epaperData[bufferIndex] = (epaperData[bufferIndex] & 0xF0) | 0x00;   // Black
-                            }
-                        }
-                    }
-                }
+        const uint8_t* row = qrData + qrY * qrSize;
+        int qrX = 0;
+        while (qrX < qrSize) {
+            if (row[qrX] != 1) {
+                qrX++;
+                continue;
             }
+            int start = qrX;
+            while (qrX < qrSize && row[qrX] == 1) {
+                qrX++;
+            }
+            canvas.fillRect(left + start * scale, top + qrY * scale,
+                            (qrX - start) * scale, scale, EPD_7IN3F_BLACK);
+        }
+    }
+}
+
+QROverlay::QROverlay() :
+    output(nullptr), modules(nullptr), size(0), left(0), top(0), scale(1), position(0) {
+}
+
+void QROverlay::setCode(const uint8_t* code, int codeSize, int centerX, int centerY, int moduleScale) {
+    modules = code;
+    size = codeSize;
+    scale = moduleScale;
+    left = centerX - (size * scale) / 2;
+    top = centerY - (size * scale) / 2;
+}
+
+bool QROverlay::beginFrame(size_t frameSize) {
+    position = 0;
+    return output && output->beginFrame(frameSize);
+}
+
+bool QROverlay::writeFrame(const uint8_t* data, size_t length) {
+    int bottom = top + size * scale;
+    while (length > 0) {
+        // One row at a time, so rows outside the code pass straight through
+        size_t row = position / DISPLAY_ROW_BYTES;
+        size_t count = min(length, (row + 1) * DISPLAY_ROW_BYTES - position);
+        const uint8_t* chunk = data;
+        
+        if (modules && (int)row >= top && (int)row < bottom) {
+            memcpy(buffer, data, count);
+            paint(buffer, position, count);
+            chunk = buffer;
+        }
+        if (!output->writeFrame(chunk, count)) {
+            return false;
+        }
+        
+        data += count;
+        length -= count;
+        position += count;
+    }
+    return true;
+}
+
+bool QROverlay::endFrame(bool commit) {
+    return output && output->endFrame(commit);
+}
+
+void QROverlay::paint(uint8_t* data, size_t offset, size_t length) const {
+    int y = offset / DISPLAY_ROW_BYTES;
+    const uint8_t* row = modules + ((y - top) / scale) * size;
+    int right = left + size * scale;
+    
+    for (size_t i = 0; i < length; i++) {
+        int x = ((offset + i) % DISPLAY_ROW_BYTES) * 2;
+        if (x + 1 < left || x >= right) continue;
+        
+        // Left pixel in the high nibble
+        for (int pixel = 0; pixel < 2; pixel++) {
+            int px = x + pixel;
+            if (px < left || px >= right) continue;
+            uint8_t color = row[(px - left) / scale] ? EPD_7IN3F_BLACK : EPD_7IN3F_WHITE;
+            int shift = pixel ? 0 : 4;
+            data[i] = (data[i] & ~(0x0F << shift)) | (color << shift);
         }
     }
 }
@@ -0,0 +1,20 @@
+#include "rtc_state.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+RTC_DATA_ATTR RtcState rtcState;
+
+bool rtcStateBegin() {
+    if (rtcState.magic == RTC_STATE_MAGIC && rtcState.size == sizeof(RtcState)) {
+        return true;
+    }
+    
+    rtcStateReset();
+    return false;
+}
+
+void rtcStateReset() {
+    memset(&rtcState, 0, sizeof(rtcState));
+    rtcState.magic = RTC_STATE_MAGIC;
+    rtcState.size = sizeof(RtcState);
+}
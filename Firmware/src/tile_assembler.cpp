@@ -0,0 +1,216 @@
+#include "tile_assembler.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+TileAssembler::TileAssembler() :
+    decoder(nullptr), cache(nullptr), writer(this), frame(nullptr), entries(nullptr),
+    rangeStart(0), rangeEnd(0), rangeCount(0), rangePos(0), streamPos(0), tileOpen(false) {
+    memset(&header, 0, sizeof(header));
+}
+
+bool TileAssembler::begin(uint8_t* target, size_t indexSize) {
+    frame = target;
+    if (!frame || !decoder || indexSize < TILE_INDEX_HEADER_SIZE) {
+        return false;
+    }
+    
+    memcpy(&header, indexData, sizeof(header));
+    if (header.magic != TILE_INDEX_MAGIC || header.version != TILE_INDEX_VERSION ||
+        header.tileSize != TILE_SIZE || header.columns != TILE_COLUMNS || header.rows != TILE_ROWS ||
+        indexSize != TILE_INDEX_MAX_SIZE) {
+        Serial.printf("Tile index v%d (%dx%d tiles of %d) does not match the display\n",
+                      header.version, header.columns, header.rows, header.tileSize);
+        return false;
+    }
+    entries = (const TileIndexEntry*)(indexData + TILE_INDEX_HEADER_SIZE);
+    
+    int cached = 0;
+    int repeated = 0;
+    int missing = 0;
+    for (int i = 0; i < TILE_COUNT; i++) {
+        state[i] = TILE_MISSING;
+        for (int j = 0; j < i; j++) {
+            if (entries[j].crc == entries[i].crc) {
+                state[i] = TILE_REPEAT;
+                source[i] = j;  // The first of them, never a repeat itself
+                break;
+            }
+        }
+        
+        if (state[i] == TILE_REPEAT) {
+            repeated++;
+        } else if (cache && cache->read(entries[i].crc, tile)) {
+            blitTile(i, tile);
+            state[i] = TILE_DONE;
+            cached++;
+        } else {
+            missing++;
+        }
+    }
+    
+    Serial.printf("Tiles: %d cached, %d repeated, %d to download\n", cached, repeated, missing);
+    return true;
+}
+
+bool TileAssembler::nextRange(uint32_t& start, uint32_t& end) {
+    // Missing tiles by pack offset
+    int count = 0;
+    for (int i = 0; i < TILE_COUNT; i++) {
+        if (state[i] != TILE_MISSING) continue;
+        int k = count++;
+        while (k > 0 && entries[rangeTiles[k - 1]].offset > entries[i].offset) {
+            rangeTiles[k] = rangeTiles[k - 1];
+            k--;
+        }
+        rangeTiles[k] = i;
+    }
+    if (count == 0) {
+        return false;
+    }
+    
+    // Downloading a short run of cached tiles again is cheaper than another request
+    rangeStart = entries[rangeTiles[0]].offset;
+    rangeEnd = rangeStart + entries[rangeTiles[0]].length - 1;
+    rangeCount = 1;
+    while (rangeCount < count) {
+        const TileIndexEntry& next = entries[rangeTiles[rangeCount]];
+        if (next.offset <= rangeEnd || next.offset - rangeEnd - 1 > TILE_RANGE_GAP) break;
+        rangeEnd = next.offset + next.length - 1;
+        rangeCount++;
+    }
+    start = rangeStart;
+    end = rangeEnd;
+    return true;
+}
+
+bool TileAssembler::beginFrame(size_t rangeSize) {
+    if (rangeCount == 0 || rangeSize != rangeEnd - rangeStart + 1) {
+        return false;
+    }
+    rangePos = 0;
+    streamPos = rangeStart;
+    tileOpen = false;
+    return true;
+}
+
+bool TileAssembler::writeFrame(const uint8_t* data, size_t length) {
+    while (length > 0 && rangePos < rangeCount) {
+        uint8_t position = rangeTiles[rangePos];
+        const TileIndexEntry& entry = entries[position];
+        
+        // Bytes of tiles that are already in place
+        if (streamPos < entry.offset) {
+            size_t skip = min(length, (size_t)(entry.offset - streamPos));
+            data += skip;
+            length -= skip;
+            streamPos += skip;
+            continue;
+        }
+        
+        if (!tileOpen) {
+            writer.start(position);
+            if (!decoder->beginFrame(entry.length)) return false;
+            tileOpen = true;
+        }
+        
+        // Tiles are always whole; a delta would go to the patcher instead
+        size_t take = min(length, (size_t)(entry.offset + entry.length - streamPos));
+        if (!decoder->writeFrame(data, take) || decoder->isDelta()) {
+            decoder->endFrame(false);
+            tileOpen = false;
+            return false;
+        }
+        data += take;
+        length -= take;
+        streamPos += take;
+        
+        if (streamPos == entry.offset + entry.length) {
+            tileOpen = false;
+            if (!decoder->endFrame(true)) return false;
+            rangePos++;
+        }
+    }
+    return true;
+}
+
+bool TileAssembler::endFrame(bool commit) {
+    if (tileOpen) {
+        decoder->endFrame(false);
+        tileOpen = false;
+    }
+    bool complete = commit && rangePos == rangeCount;
+    rangeCount = 0;
+    return complete;
+}
+
+bool TileAssembler::finish() {
+    for (int i = 0; i < TILE_COUNT; i++) {
+        if (state[i] == TILE_MISSING) {
+            return false;
+        }
+    }
+    for (int i = 0; i < TILE_COUNT; i++) {
+        if (state[i] == TILE_REPEAT) {
+            copyTile(i, source[i]);
+        }
+    }
+    
+    uint32_t crc = frameCrc32(0, frame, DISPLAY_FRAME_SIZE);
+    if (crc != header.frameCrc) {
+        Serial.printf("Assembled frame CRC %08X does not match the index (%08X)\n", crc, header.frameCrc);
+        return false;
+    }
+    return true;
+}
+
+uint8_t* TileAssembler::tileOrigin(int position) const {
+    int column = position % TILE_COLUMNS;
+    int row = position / TILE_COLUMNS;
+    return frame + (size_t)row * TILE_SIZE * DISPLAY_ROW_BYTES + column * TILE_ROW_BYTES;
+}
+
+void TileAssembler::blitTile(int position, const uint8_t* pixels) {
+    uint8_t* target = tileOrigin(position);
+    for (int y = 0; y < TILE_SIZE; y++) {
+        memcpy(target + y * DISPLAY_ROW_BYTES, pixels + y * TILE_ROW_BYTES, TILE_ROW_BYTES);
+    }
+}
+
+void TileAssembler::copyTile(int to, int from) {
+    uint8_t* target = tileOrigin(to);
+    const uint8_t* origin = tileOrigin(from);
+    for (int y = 0; y < TILE_SIZE; y++) {
+        memcpy(target + y * DISPLAY_ROW_BYTES, origin + y * DISPLAY_ROW_BYTES, TILE_ROW_BYTES);
+    }
+}
+
+bool TileAssembler::TileWriter::beginFrame(size_t frameSize) {
+    received = 0;
+    crc = 0;
+    return frameSize == TILE_BYTES;
+}
+
+bool TileAssembler::TileWriter::writeFrame(const uint8_t* data, size_t length) {
+    if (received + length > TILE_BYTES) {
+        return false;
+    }
+    memcpy(owner->tile + received, data, length);
+    crc = frameCrc32(crc, data, length);
+    received += length;
+    return true;
+}
+
+bool TileAssembler::TileWriter::endFrame(bool commit) {
+    const TileIndexEntry& entry = owner->entries[position];
+    if (!commit || received != TILE_BYTES || crc != entry.crc) {
+        Serial.printf("Tile %d failed its check (CRC %08X, expected %08X)\n", position, crc, entry.crc);
+        return false;
+    }
+    
+    owner->blitTile(position, owner->tile);
+    owner->state[position] = TILE_DONE;
+    if (owner->cache) {
+        owner->cache->write(entry.crc, owner->tile);
+    }
+    return true;
+}
@@ -0,0 +1,150 @@
+#include "tile_cache.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+#include <LittleFS.h>
+
+TileCache::TileCache() : ready(false), dirty(false), hits(0), misses(0) {
+    memset(&index, 0, sizeof(index));
+}
+
+bool TileCache::begin() {
+    memset(&index, 0, sizeof(index));
+    
+    File file = LittleFS.open(TILE_CACHE_INDEX_PATH, FILE_READ);
+    bool indexValid = file && file.read((uint8_t*)&index, sizeof(index)) == sizeof(index) &&
+                      index.magic == TILE_CACHE_INDEX_MAGIC && index.slots == TILE_CACHE_SLOTS;
+    if (file) {
+        file.close();
+    }
+    if (!indexValid) {
+        memset(&index, 0, sizeof(index));
+    }
+    index.magic = TILE_CACHE_INDEX_MAGIC;
+    index.slots = TILE_CACHE_SLOTS;
+    
+    if (!openPack()) {
+        Serial.println("Failed to open the tile cache");
+        return false;
+    }
+    
+    // Slots past the end of the pack were never written
+    int cached = 0;
+    size_t packSlots = pack.size() / TILE_BYTES;
+    for (int slot = 0; slot < TILE_CACHE_SLOTS; slot++) {
+        Entry& entry = index.entries[slot];
+        if (entry.lastUse > 0 && (size_t)slot >= packSlots) {
+            entry.crc = 0;
+            entry.lastUse = 0;
+        }
+        if (entry.lastUse > 0) {
+            cached++;
+        }
+    }
+    
+    ready = true;
+    Serial.printf("Tile cache: %d/%d tiles\n", cached, TILE_CACHE_SLOTS);
+    return true;
+}
+
+bool TileCache::openPack() {
+    if (!LittleFS.exists(TILE_CACHE_PACK_PATH)) {
+        File created = LittleFS.open(TILE_CACHE_PACK_PATH, FILE_WRITE);
+        if (!created) return false;
+        created.close();
+    }
+    
+    // Read and overwrite in place; FILE_WRITE would truncate the pack
+    pack = LittleFS.open(TILE_CACHE_PACK_PATH, "r+");
+    return (bool)pack;
+}
+
+int TileCache::find(uint32_t crc) const {
+    for (int slot = 0; slot < TILE_CACHE_SLOTS; slot++) {
+        if (index.entries[slot].lastUse > 0 && index.entries[slot].crc == crc) {
+            return slot;
+        }
+    }
+    return -1;
+}
+
+int TileCache::pickSlot() const {
+    // The lowest empty slot keeps the pack contiguous; once it is full the
+    // least recently used tile goes
+    int oldest = 0;
+    for (int slot = 0; slot < TILE_CACHE_SLOTS; slot++) {
+        if (index.entries[slot].lastUse == 0) {
+            return slot;
+        }
+        if (index.entries[slot].lastUse < index.entries[oldest].lastUse) {
+            oldest = slot;
+        }
+    }
+    return oldest;
+}
+
+bool TileCache::read(uint32_t crc, uint8_t* tile) {
+    int slot = ready ? find(crc) : -1;
+    if (slot < 0) {
+        misses++;
+        return false;
+    }
+    
+    Entry& entry = index.entries[slot];
+    if (!pack.seek((size_t)slot * TILE_BYTES) || pack.read(tile, TILE_BYTES) != TILE_BYTES ||
+        frameCrc32(0, tile, TILE_BYTES) != crc) {
+        Serial.printf("Cached tile %08X is damaged - dropping it\n", crc);
+        entry.crc = 0;
+        entry.lastUse = 0;
+        dirty = true;
+        misses++;
+        return false;
+    }
+    
+    entry.lastUse = ++index.useCounter;
+    dirty = true;
+    hits++;
+    return true;
+}
+
+bool TileCache::write(uint32_t crc, const uint8_t* tile) {
+    if (!ready) {
+        return false;
+    }
+    if (find(crc) >= 0) {
+        return true;
+    }
+    
+    // The slot's old tile is gone from here on, even if the write fails
+    int slot = pickSlot();
+    Entry& entry = index.entries[slot];
+    entry.crc = 0;
+    entry.lastUse = 0;
+    dirty = true;
+    
+    if (!pack.seek((size_t)slot * TILE_BYTES) || pack.write(tile, TILE_BYTES) != TILE_BYTES) {
+        Serial.println("Flash write failed - tile not cached");
+        return false;
+    }
+    
+    entry.crc = crc;
+    entry.lastUse = ++index.useCounter;
+    return true;
+}
+
+bool TileCache::flush() {
+    if (!ready || !dirty) {
+        return true;
+    }
+    pack.flush();
+    
+    // LittleFS commits small files atomically; the CRC check on every read
+    // covers slots written after the last flush
+    File file = LittleFS.open(TILE_CACHE_INDEX_PATH, FILE_WRITE);
+    if (!file) {
+        return false;
+    }
+    bool written = file.write((const uint8_t*)&index, sizeof(index)) == sizeof(index);
+    file.close();
+    dirty = !written;
+    return written;
+}
@@ -0,0 +1,137 @@
+#include "update_policy.h"
+#include "config.h"
+#include "metrics.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+UpdatePolicy::UpdatePolicy() : downloadCountAtWake(0) {
+}
+
+void UpdatePolicy::begin() {
+#if METRICS_ENABLED
+    downloadCountAtWake = metricsGet(METRIC_DOWNLOAD).count;
+#endif
+
+    uint16_t mv = readBatteryMv();
+    rtcState.batteryMv = mv;
+    if (mv == 0) {
+        rtcState.policyBattery = BATTERY_UNKNOWN;
+        return;
+    }
+    
+    BatteryLevel level = BATTERY_NORMAL;
+    if (mv < BATTERY_CRITICAL_MV) {
+        level = BATTERY_CRITICAL;
+    } else if (mv < BATTERY_LOW_MV) {
+        level = BATTERY_LOW;
+    }
+    
+    // A resting cell reads higher than one under load, so a level is only
+    // left upwards once the voltage has clearly recovered
+    BatteryLevel previous = getBatteryLevel();
+    if (previous == BATTERY_CRITICAL && level != BATTERY_CRITICAL &&
+        mv < BATTERY_CRITICAL_MV + BATTERY_HYSTERESIS_MV) {
+        level = BATTERY_CRITICAL;
+    } else if (previous >= BATTERY_LOW && level == BATTERY_NORMAL &&
+               mv < BATTERY_LOW_MV + BATTERY_HYSTERESIS_MV) {
+        level = BATTERY_LOW;
+    }
+    rtcState.policyBattery = level;
+}
+
+uint16_t UpdatePolicy::readBatteryMv() const {
+#if BATTERY_ADC_PIN >= 0
+    uint32_t sum = 0;
+    for (int i = 0; i < BATTERY_SAMPLES; i++) {
+        sum += analogReadMilliVolts(BATTERY_ADC_PIN);
+    }
+    return (uint16_t)(sum / BATTERY_SAMPLES * BATTERY_DIVIDER_RATIO);
+#else
+    return 0;
+#endif
+}
+
+void UpdatePolicy::recordLink(int rssi) {
+    if (rtcState.policyRssi == 0) {
+        rtcState.policyRssi = rssi;
+    } else {
+        rtcState.policyRssi += (rssi - rtcState.policyRssi) / (1 << POLICY_AVERAGE_SHIFT);
+    }
+    updateLinkState();
+}
+
+void UpdatePolicy::recordDownload() {
+#if METRICS_ENABLED
+    // Only a body downloaded this wake counts, and short ones are mostly
+    // TCP slow start - they say little about the link
+    const MetricStats& stats = metricsGet(METRIC_DOWNLOAD);
+    uint32_t bytes = metricsGetDownloadBytes();
+    if (stats.count == downloadCountAtWake || stats.lastUs == 0 || bytes < LINK_MIN_SAMPLE_BYTES) {
+        return;
+    }
+    
+    int32_t kBps = (int32_t)min((uint64_t)bytes * 1000 / stats.lastUs, (uint64_t)0xFFFF);
+    if (rtcState.policyKBps == 0) {
+        rtcState.policyKBps = kBps;
+    } else {
+        rtcState.policyKBps += (kBps - (int32_t)rtcState.policyKBps) / (1 << POLICY_AVERAGE_SHIFT);
+    }
+    updateLinkState();
+#endif
+}
+
+void UpdatePolicy::updateLinkState() {
+    // Between the two RSSI thresholds the link keeps its last rating
+    bool slow = rtcState.policyKBps > 0 && rtcState.policyKBps < LINK_SLOW_KBPS;
+    if (rtcState.policyRssi < LINK_WEAK_RSSI_DBM || slow) {
+        rtcState.policyWeakLink = 1;
+    } else if (rtcState.policyRssi >= LINK_GOOD_RSSI_DBM) {
+        rtcState.policyWeakLink = 0;
+    }
+}
+
+uint32_t UpdatePolicy::intervalScale() const {
+    uint32_t scale = weakLink() ? WEAK_LINK_INTERVAL_SCALE : 1;
+    if (getBatteryLevel() == BATTERY_CRITICAL) {
+        scale *= CRITICAL_BATTERY_INTERVAL_SCALE;
+    }
+    return scale;
+}
+
+bool UpdatePolicy::deferOverlay(const WeatherData& weather, time_t now) const {
+    BatteryLevel level = getBatteryLevel();
+    if (level < BATTERY_LOW || rtcState.overlayCrc == 0 || now <= 0 || rtcState.overlayDrawnEpoch == 0) {
+        return false;
+    }
+    
+    // New weather always goes up; a critical battery lets one degree slide
+    int tolerance = level == BATTERY_CRITICAL ? 1 : 0;
+    if (weather.hasWeather != (bool)rtcState.overlayHasWeather ||
+        (weather.hasWeather && (strcmp(weather.icon, rtcState.overlayIcon) != 0 ||
+                                abs(weather.temperature - rtcState.overlayTemperature) > tolerance))) {
+        return false;
+    }
+    
+    // Only the clock moved: let it fall behind, but never past midnight
+    uint32_t drawn = rtcState.overlayDrawnEpoch;
+    uint32_t maxAge = level == BATTERY_CRITICAL ? CRITICAL_BATTERY_CLOCK_AGE_S : LOW_BATTERY_CLOCK_AGE_S;
+    bool sameDay = (now + weather.utcOffset) / 86400 == ((time_t)drawn + weather.utcOffset) / 86400;
+    return sameDay && (uint32_t)now - drawn < maxAge;
+}
+
+const char* UpdatePolicy::describe() const {
+    static const char* const names[2][4] = {
+        { "normal", "normal", "low battery", "critical battery" },
+        { "weak link", "weak link", "weak link, low battery", "weak link, critical battery" },
+    };
+    return names[weakLink() ? 1 : 0][getBatteryLevel()];
+}
+
+void UpdatePolicy::toJson(JsonObject obj) const {
+    obj["mode"] = describe();
+    obj["interval_scale"] = intervalScale();
+    obj["defer_overlay"] = getBatteryLevel() >= BATTERY_LOW;
+    obj["rssi"] = rtcState.policyRssi;
+    obj["throughput_kBps"] = rtcState.policyKBps;
+    obj["battery_mv"] = rtcState.batteryMv;
+}
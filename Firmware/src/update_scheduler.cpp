@@ -0,0 +1,183 @@
+#include "update_scheduler.h"
+#include "config.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+#include <time.h>
+#include <esp_sleep.h>
+
+// Avalanche mix so neighbouring MACs and attempts land far apart
+static uint32_t mix32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352DUL;
+    x ^= x >> 15;
+    x *= 0x846CA68BUL;
+    x ^= x >> 16;
+    return x;
+}
+
+UpdateScheduler::UpdateScheduler() : timerWake(false), dwellSeconds(0), intervalScale(1), deviceSeed(0) {
+}
+
+void UpdateScheduler::begin() {
+    uint64_t mac = ESP.getEfuseMac();
+    deviceSeed = mix32((uint32_t)mac ^ mix32((uint32_t)(mac >> 32)));
+    
+    bool restored = rtcStateBegin();
+    timerWake = restored && esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER;
+    
+    if (timerWake) {
+        rtcState.wakeCount++;
+        Serial.printf("Woke from deep sleep (wake #%d, %d failures)\n", 
+                      rtcState.wakeCount, rtcState.consecutiveFailures);
+    } else {
+        Serial.println("Cold boot - scheduler state reset");
+    }
+}
+
+bool UpdateScheduler::hasValidClock() const {
+    return time(nullptr) > (time_t)MIN_VALID_EPOCH;
+}
+
+bool UpdateScheduler::syncClock() {
+    time_t now = time(nullptr);
+    
+    // The system time keeps running through deep sleep; resync only to
+    // correct RTC drift
+    if (hasValidClock() && rtcState.lastClockSyncEpoch > 0 &&
+        (uint32_t)now - rtcState.lastClockSyncEpoch < CLOCK_RESYNC_INTERVAL_S) {
+        return true;
+    }
+    
+    Serial.println("Synchronising clock via SNTP...");
+    configTime(0, 0, NTP_SERVER_1, NTP_SERVER_2);
+    
+    unsigned long start = millis();
+    while (!hasValidClock() && millis() - start < 5000) {
+        delay(50);
+    }
+    
+    if (!hasValidClock()) {
+        Serial.println("SNTP sync failed - using fixed update period");
+        return false;
+    }
+    
+    rtcState.lastClockSyncEpoch = (uint32_t)time(nullptr);
+    Serial.printf("Clock synchronised in %lu ms\n", millis() - start);
+    return true;
+}
+
+uint32_t UpdateScheduler::jitter(uint32_t range, uint32_t salt) const {
+    return range > 0 ? mix32(deviceSeed ^ (salt * 0x9E3779B9UL)) % range : 0;
+}
+
+void UpdateScheduler::staggerColdStart() const {
+    uint32_t delayMs = jitter(COLD_BOOT_JITTER_MS, 0);
+    Serial.printf("Cold boot - staggering first fetch by %d ms\n", delayMs);
+    delay(delayMs);
+}
+
+void UpdateScheduler::recordSuccess() {
+    rtcState.consecutiveFailures = 0;
+    rtcState.backoffSeconds = 0;
+    rtcState.retryDelaySeconds = 0;
+    if (hasValidClock()) {
+        rtcState.lastSuccessEpoch = (uint32_t)time(nullptr);
+    }
+}
+
+void UpdateScheduler::recordFailure(int httpCode, uint32_t retryAfterS) {
+    rtcState.consecutiveFailures++;
+    uint32_t attempt = rtcState.consecutiveFailures;
+    
+    // Transport errors, bodies cut short after a 200/206 and 5xx are
+    // usually over within seconds
+    bool rateLimited = httpCode == 429 || retryAfterS > 0;
+    bool transient = httpCode < 0 || httpCode == 200 || httpCode == 206 || httpCode >= 500;
+    uint32_t delaySeconds;
+    
+    if (rateLimited) {
+        // The server's figure is a floor; the device offset keeps the fleet
+        // from coming back all at once when it expires
+        if (rtcState.backoffSeconds == 0) {
+            rtcState.backoffSeconds = RETRY_BASE_DELAY_S;
+        }
+        delaySeconds = max(retryAfterS, rtcState.backoffSeconds) + jitter(SCHEDULE_JITTER_S, attempt);
+        delaySeconds = min((uint32_t)MAX_SCHEDULED_SLEEP_S, delaySeconds);
+        rtcState.backoffSeconds = min((uint32_t)MAX_RETRY_DELAY_S, rtcState.backoffSeconds * 2);
+        Serial.printf("Rate limited (HTTP %d, Retry-After %d s)\n", httpCode, retryAfterS);
+    } else if (transient && attempt <= FAST_RETRY_ATTEMPTS) {
+        // Quick retries leave the backoff base untouched
+        delaySeconds = FAST_RETRY_DELAY_S + jitter(FAST_RETRY_DELAY_S, attempt);
+        Serial.printf("Transient error (HTTP %d) - fast retry %d/%d\n", 
+                      httpCode, attempt, FAST_RETRY_ATTEMPTS);
+    } else {
+        if (rtcState.backoffSeconds == 0) {
+            rtcState.backoffSeconds = RETRY_BASE_DELAY_S;
+        } else {
+            rtcState.backoffSeconds = min((uint32_t)MAX_RETRY_DELAY_S, rtcState.backoffSeconds * 2);
+        }
+        // Equal jitter: half the backoff is fixed, the other half spread
+        uint32_t half = rtcState.backoffSeconds / 2;
+        delaySeconds = max((uint32_t)MIN_SLEEP_S, half + jitter(half + 1, attempt));
+    }
+    
+    rtcState.retryDelaySeconds = delaySeconds;
+    Serial.printf("Update failed (%d in a row) - retrying in %d s\n", attempt, delaySeconds);
+}
+
+uint32_t UpdateScheduler::secondsUntilNextUpdate() const {
+    if (rtcState.consecutiveFailures > 0 && rtcState.retryDelaySeconds > 0) {
+        return rtcState.retryDelaySeconds;
+    }
+    
+    // Devices powered up together would otherwise stay in lockstep
+    if (!hasValidClock()) {
+        return SERVER_UPDATE_PERIOD_S * intervalScale + jitter(SCHEDULE_JITTER_S, 0);
+    }
+    
+    uint32_t now = (uint32_t)time(nullptr);
+    uint32_t offset = SERVER_PUBLISH_DELAY_S + jitter(SCHEDULE_JITTER_S, 0);
+    uint32_t skipped = (intervalScale - 1) * SERVER_UPDATE_PERIOD_S;  // Slots the policy passes over
+    
+    // The manifest announced the next generation; wake once it is published.
+    // A late or implausible announcement falls back to the cron slots.
+    if (rtcState.nextServerUpdateEpoch > 0) {
+        uint32_t target = rtcState.nextServerUpdateEpoch + offset + skipped;
+        if (target > now + MIN_SLEEP_S && target - now <= MAX_SCHEDULED_SLEEP_S) {
+            return target - now;
+        }
+    }
+    
+    // Next generation slot plus the publish delay and device offset,
+    // skipping slots that are too close to be worth waking for
+    uint32_t slot = (now - offset) / SERVER_UPDATE_PERIOD_S + 1;
+    uint32_t target = slot * SERVER_UPDATE_PERIOD_S + offset + skipped;
+    
+    while (target - now < MIN_SLEEP_S) {
+        target += SERVER_UPDATE_PERIOD_S;
+    }
+    
+    return target - now;
+}
+
+void UpdateScheduler::sleepUntilNextUpdate() {
+    uint32_t untilRefresh = refreshDue() ? secondsUntilNextUpdate() : rtcState.refreshCountdownS;
+    uint32_t sleepSeconds = untilRefresh;
+    
+    // Playlists wake after each dwell to rotate; a remainder too short to
+    // sleep on is added to the last dwell instead
+    if (dwellSeconds > 0 && untilRefresh >= dwellSeconds + MIN_SLEEP_S) {
+        sleepSeconds = dwellSeconds;
+    }
+    rtcState.refreshCountdownS = untilRefresh - sleepSeconds;
+    rtcState.rotationPending = dwellSeconds > 0 && sleepSeconds >= dwellSeconds;
+    
+    if (rtcState.refreshCountdownS > 0) {
+        Serial.printf("Next update in %d s\n", untilRefresh);
+    }
+    Serial.printf("Awake for %lu ms - sleeping for %d s\n", millis(), sleepSeconds);
+    Serial.flush();
+    
+    esp_sleep_enable_timer_wakeup((uint64_t)sleepSeconds * 1000000ULL);
+    esp_deep_sleep_start();
+}
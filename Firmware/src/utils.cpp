@@ -1,14 +1,6 @@
 #include "utils.h"
 #include "serial_config.h"  // Must be included first
 
-String repeat(const char* str, int count) {
-    String result = "";
-    for (int i = 0; i < count; i++) {
-        result += str;
-    }
-    return result;
-}
-
 void printProgressBar(int progress, int total, int width) {
     int pos = (progress * width) / total;
     Serial.print("[");
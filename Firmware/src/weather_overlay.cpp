@@ -0,0 +1,177 @@
+#include "weather_overlay.h"
+#include "weather_sprites.h"
+#include "epd7in3f.h"
+#include "frame_format.h"
+#include "rtc_state.h"
+#include "serial_config.h"  // Must be included before Arduino.h
+#include <Arduino.h>
+
+WeatherOverlay::WeatherOverlay() : output(nullptr), offset(0), bandCrc(0), renderedAt(0) {
+    memset(band, 0x11, sizeof(band));  // White
+    memset(&rendered, 0, sizeof(rendered));
+}
+
+uint32_t WeatherOverlay::render(const WeatherData& data, time_t now) {
+    rendered = data;
+    renderedAt = now;
+    
+    Canvas canvas(band, OVERLAY_BAND_WIDTH, OVERLAY_BAND_HEIGHT);
+    canvas.fill(EPD_7IN3F_WHITE);
+    
+    char dateText[24] = "";
+    char timeText[8] = "";
+    char tempText[8] = "";
+    
+    // The device clock is more current than anything the server could print
+    if (now > 0) {
+        time_t local = now + data.utcOffset;
+        struct tm tm;
+        gmtime_r(&local, &tm);
+        strftime(dateText, sizeof(dateText), "%d %B", &tm);
+        strftime(timeText, sizeof(timeText), "%H:%M", &tm);
+    }
+    
+    const uint8_t* icon = nullptr;
+    if (data.hasWeather) {
+        snprintf(tempText, sizeof(tempText), "%d\xB0" "C", data.temperature);
+        for (int i = 0; i < WEATHER_ICON_COUNT; i++) {
+            if (strcmp(WEATHER_ICONS[i].code, data.icon) == 0) {
+                icon = WEATHER_ICONS[i].bitmap;
+                break;
+            }
+        }
+    }
+    
+    int dateWidth = textWidth(SPRITE_FONT_DATE, dateText);
+    int timeWidth = textWidth(SPRITE_FONT_TIME, timeText);
+    int clockWidth = max(dateWidth, timeWidth);
+    int tempWidth = textWidth(SPRITE_FONT_TEMP, tempText);
+    
+    // Clock, icon and temperature side by side, centered like the server layout
+    int total = 0;
+    int groups = 0;
+    if (clockWidth > 0) { total += clockWidth; groups++; }
+    if (icon) { total += WEATHER_ICON_SIZE; groups++; }
+    if (tempWidth > 0) { total += tempWidth; groups++; }
+    if (groups > 1) total += (groups - 1) * OVERLAY_GROUP_SPACING;
+    
+    int u = (OVERLAY_BAND_HEIGHT - total) / 2;
+    
+    if (clockWidth > 0) {
+        int v = (OVERLAY_BAND_WIDTH - SPRITE_FONT_DATE.height - SPRITE_FONT_TIME.height) / 2;
+        drawText(canvas, SPRITE_FONT_DATE, dateText, u + (clockWidth - dateWidth) / 2, v);
+        drawText(canvas, SPRITE_FONT_TIME, timeText, u + (clockWidth - timeWidth) / 2, 
+                 v + SPRITE_FONT_DATE.height);
+        u += clockWidth + OVERLAY_GROUP_SPACING;
+    }
+    
+    if (icon) {
+        drawSprite(canvas, icon, u, (OVERLAY_BAND_WIDTH - WEATHER_ICON_SIZE) / 2, 
+                   WEATHER_ICON_SIZE, WEATHER_ICON_SIZE);
+        u += WEATHER_ICON_SIZE + OVERLAY_GROUP_SPACING;
+    } else if (data.hasWeather) {
+        Serial.printf("No sprite for weather icon '%s'\n", data.icon);
+    }
+    
+    if (tempWidth > 0) {
+        drawText(canvas, SPRITE_FONT_TEMP, tempText, u, (OVERLAY_BAND_WIDTH - SPRITE_FONT_TEMP.height) / 2);
+    }
+    
+    bandCrc = frameCrc32(0, band, sizeof(band));
+    Serial.printf("Overlay: %s %s %s (CRC %08X)\n", dateText, timeText, 
+                  data.hasWeather ? data.icon : "-", bandCrc);
+    return bandCrc;
+}
+
+bool WeatherOverlay::beginFrame(size_t frameSize) {
+    if (!output) return false;
+    
+    offset = 0;
+    return output->beginFrame(frameSize);
+}
+
+bool WeatherOverlay::writeFrame(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        size_t row = offset / DISPLAY_ROW_BYTES;
+        size_t col = offset % DISPLAY_ROW_BYTES;
+        const uint8_t* source = data;
+        size_t count;
+        
+        if (row >= OVERLAY_BAND_Y && row < OVERLAY_BAND_Y + OVERLAY_BAND_HEIGHT &&
+            col >= OVERLAY_BAND_X / 2 && col < OVERLAY_BAND_X / 2 + OVERLAY_BAND_ROW_BYTES) {
+            // Inside the band the rendered bytes replace the base
+            source = band + (row - OVERLAY_BAND_Y) * OVERLAY_BAND_ROW_BYTES + (col - OVERLAY_BAND_X / 2);
+            count = OVERLAY_BAND_X / 2 + OVERLAY_BAND_ROW_BYTES - col;
+        } else {
+            count = nextBandOffset() - offset;
+        }
+        
+        if (count > length) count = length;
+        if (!output->writeFrame(source, count)) return false;
+        
+        data += count;
+        length -= count;
+        offset += count;
+    }
+    return true;
+}
+
+bool WeatherOverlay::endFrame(bool commit) {
+    if (!output) return false;
+    
+    bool ok = output->endFrame(commit);
+    if (ok) {
+        rtcState.overlayCrc = bandCrc;
+        rtcState.overlayDrawnEpoch = (uint32_t)renderedAt;
+        rtcState.overlayHasWeather = rendered.hasWeather;
+        rtcState.overlayTemperature = (int8_t)rendered.temperature;
+        memcpy(rtcState.overlayIcon, rendered.icon, sizeof(rtcState.overlayIcon));
+    }
+    return ok;
+}
+
+size_t WeatherOverlay::nextBandOffset() const {
+    size_t row = offset / DISPLAY_ROW_BYTES;
+    size_t col = offset % DISPLAY_ROW_BYTES;
+    
+    if (row < OVERLAY_BAND_Y) {
+        return OVERLAY_BAND_Y * DISPLAY_ROW_BYTES + OVERLAY_BAND_X / 2;
+    }
+    if (row < OVERLAY_BAND_Y + OVERLAY_BAND_HEIGHT) {
+        if (col < OVERLAY_BAND_X / 2) return row * DISPLAY_ROW_BYTES + OVERLAY_BAND_X / 2;
+        if (row + 1 < OVERLAY_BAND_Y + OVERLAY_BAND_HEIGHT) return (row + 1) * DISPLAY_ROW_BYTES + OVERLAY_BAND_X / 2;
+    }
+    return SIZE_MAX;  // Past the band
+}
+
+const SpriteGlyph* WeatherOverlay::findGlyph(const SpriteFont& font, uint8_t code) {
+    for (int i = 0; i < font.glyphCount; i++) {
+        if (font.glyphs[i].code == code) return &font.glyphs[i];
+    }
+    return nullptr;
+}
+
+int WeatherOverlay::textWidth(const SpriteFont& font, const char* text) {
+    int width = 0;
+    for (const char* c = text; *c; c++) {
+        const SpriteGlyph* glyph = findGlyph(font, (uint8_t)*c);
+        if (glyph) width += glyph->advance;
+    }
+    return width;
+}
+
+void WeatherOverlay::drawText(Canvas& canvas, const SpriteFont& font, const char* text, int u, int v) {
+    for (const char* c = text; *c; c++) {
+        const SpriteGlyph* glyph = findGlyph(font, (uint8_t)*c);
+        if (!glyph) continue;  // Not baked into this font
+        
+        drawSprite(canvas, font.bitmaps + glyph->offset, u, v, glyph->advance, font.height);
+        u += glyph->advance;
+    }
+}
+
+void WeatherOverlay::drawSprite(Canvas& canvas, const uint8_t* sprite, int u, int v, int width, int height) {
+    // Portrait (u, v) is panel (band width - v - height, u); sprites are
+    // stored already rotated
+    canvas.blit(sprite, OVERLAY_BAND_WIDTH - v - height, u, height, width);
+}
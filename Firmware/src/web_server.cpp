@@ -1,9 +1,21 @@
 #include "web_server.h"
 #include "serial_config.h"  // Must be included first
 #include "config.h"
+#include "metrics.h"
+#include "logger.h"
+#include "web_assets.h"
+
+// Connectivity checks of Android, iOS/macOS, Windows and Linux desktops.
+// Answering them with a redirect is what makes the OS pop up the portal.
+static const char* const CAPTIVE_PROBE_PATHS[] = {
+    "/generate_204", "/gen_204",                          // Android, ChromeOS
+    "/hotspot-detect.html", "/library/test/success.html", // Apple
+    "/connecttest.txt", "/ncsi.txt", "/redirect",         // Windows
+    "/canonical.html", "/success.txt", "/check_network_status.txt"  // Firefox, Linux
+};
 
 WebConfigServer::WebConfigServer(ConfigManager* configMgr) : 
-    server(WEB_SERVER_PORT), configManager(configMgr), serverStarted(false) {
+    server(WEB_SERVER_PORT), configManager(configMgr), updatePolicy(nullptr), serverStarted(false) {
 }
 
 bool WebConfigServer::startConfigAP() {
@@ -30,7 +42,11 @@ bool WebConfigServer::startConfigAP() {
     server.on("/", [this]() { handleRoot(); });
     server.on("/config", HTTP_POST, [this]() { handleConfig(); });
     server.on("/status", [this]() { handleStatus(); });
-    server.onNotFound([this]() { handleRoot(); }); // Redirect all unknown requests to root
+    for (const char* path : CAPTIVE_PROBE_PATHS) {
+        server.on(path, [this]() { handleRedirect(); });
+    }
+    server.on("/favicon.ico", [this]() { handleNoContent(); });
+    server.onNotFound([this]() { handleRedirect(); }); // Send all unknown requests to the portal
     
     // Start the server
     server.begin();
@@ -71,7 +87,24 @@ void WebConfigServer::handleRoot() {
     server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
     server.sendHeader("Pragma", "no-cache");
     server.sendHeader("Expires", "-1");
-    server.send(200, "text/html", getIndexPage());
+    sendAsset(WEB_INDEX_HTML, WEB_INDEX_HTML_SIZE, WEB_INDEX_HTML_TYPE);
+}
+
+void WebConfigServer::handleRedirect() {
+    // Absolute URL: the request may carry any host name the DNS server caught
+    server.sendHeader("Location", AP_PORTAL_URL);
+    server.sendHeader("Cache-Control", "no-cache");
+    server.send(302, "text/plain", "");
+}
+
+void WebConfigServer::handleNoContent() {
+    server.send(204, "text/plain", "");
+}
+
+void WebConfigServer::sendAsset(const uint8_t* data, size_t size, const char* contentType) {
+    // Straight from flash; the browser inflates it
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, contentType, (PGM_P)data, size);
 }
 
 void WebConfigServer::handleConfig() {
@@ -91,12 +124,32 @@ void WebConfigServer::handleConfig() {
     Serial.printf("Configuring: SSID=%s, Repo=%s, Path=%s\n", 
                   wifiSSID.c_str(), githubRepo.c_str(), githubPath.c_str());
     
+    // Optional playlist: one further image path per line
+    bool playlistValid = true;
+    configManager->clearPlaylist();
+    String playlist = server.arg("playlist");
+    int start = 0;
+    while (playlistValid && start < (int)playlist.length()) {
+        int end = playlist.indexOf('\n', start);
+        if (end < 0) end = playlist.length();
+        String path = playlist.substring(start, end);
+        path.trim();
+        if (path.length() > 0) {
+            playlistValid = configManager->addPlaylistPath(path.c_str());
+        }
+        start = end + 1;
+    }
+    if (playlistValid && server.arg("dwell_minutes").length() > 0) {
+        playlistValid = configManager->setDwellMinutes(server.arg("dwell_minutes").toInt());
+    }
+    
     // Validate and save configuration
-    if (configManager->setWiFiCredentials(wifiSSID.c_str(), wifiPassword.c_str()) &&
+    if (playlistValid &&
+        configManager->setWiFiCredentials(wifiSSID.c_str(), wifiPassword.c_str()) &&
         configManager->setGitHubInfo(githubRepo.c_str(), githubPath.c_str())) {
         
         if (configManager->saveConfig()) {
-            server.send(200, "text/html", getSuccessPage());
+            sendAsset(WEB_SUCCESS_HTML, WEB_SUCCESS_HTML_SIZE, WEB_SUCCESS_HTML_TYPE);
             Serial.println("Configuration saved successfully");
             
             // Schedule restart after a short delay
@@ -116,104 +169,19 @@ void WebConfigServer::handleStatus() {
     doc["wifi_ssid"] = configManager->getWiFiSSID();
     doc["github_repo"] = configManager->getGitHubRepo();
     doc["github_path"] = configManager->getGitHubImagePath();
+    doc["playlist_views"] = configManager->getViewCount();
+    doc["dwell_minutes"] = configManager->getDwellSeconds() / 60;
     doc["free_heap"] = ESP.getFreeHeap();
     doc["uptime"] = millis();
+    doc["log_dropped"] = logDropped();
+    if (updatePolicy) {
+        updatePolicy->toJson(doc["policy"].to<JsonObject>());
+    }
+#if METRICS_ENABLED
+    metricsToJson(doc["metrics"].to<JsonObject>());
+#endif
     
     String response;
     serializeJson(doc, response);
     server.send(200, "application/json", response);
 }
-
-String WebConfigServer::getIndexPage() {
-    return R"HTML(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Smart Dashboard Configuration</title>
-    <style>
-        body { font-family: Arial, sans-serif; margin: 20px; background: #f0f0f0; }
-        .container { max-width: 500px; margin: 0 auto; background: white; padding: 20px; border-radius: 10px; }
-        h1 { color: #333; text-align: center; }
-        .form-group { margin-bottom: 15px; }
-        label { display: block; margin-bottom: 5px; font-weight: bold; }
-        input[type="text"], input[type="password"] { width: 100%; padding: 8px; border: 1px solid #ddd; border-radius: 4px; box-sizing: border-box; }
-        button { background: #007cba; color: white; padding: 10px 20px; border: none; border-radius: 4px; cursor: pointer; width: 100%; }
-        button:hover { background: #005a87; }
-        .info { background: #e7f3ff; padding: 10px; border-radius: 4px; margin-top: 20px; }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h1>Smart Dashboard Setup</h1>
-        <form action="/config" method="POST">
-            <div class="form-group">
-                <label for="wifi_ssid">WiFi Network:</label>
-                <input type="text" id="wifi_ssid" name="wifi_ssid" required>
-            </div>
-            <div class="form-group">
-                <label for="wifi_password">WiFi Password:</label>
-                <input type="password" id="wifi_password" name="wifi_password">
-            </div>
-            <div class="form-group">
-                <label for="github_repo">GitHub Repository:</label>
-                <input type="text" id="github_repo" name="github_repo" required placeholder="owner/repository">
-            </div>
-            <div class="form-group">
-                <label for="github_path">Image Path:</label>
-                <input type="text" id="github_path" name="github_path" required placeholder="dashboard_480x800.png">
-            </div>
-            <button type="submit">Save Configuration</button>
-        </form>
-        <div class="info">
-            <strong>Device:</strong> ESP32-S2 Smart Dashboard<br>
-            <strong>Display:</strong> 7.3" E-Paper<br>
-            <strong>Update:</strong> Every hour
-        </div>
-    </div>
-</body>
-</html>
-)HTML";
-}
-
-String WebConfigServer::getSuccessPage() {
-    return R"HTML(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Configuration Saved</title>
-    <link rel="stylesheet" href="/style.css">
-</head>
-<body>
-    <div class="container">
-        <h1>Configuration Saved Successfully!</h1>
-        <div class="success-message">
-            <p>Your Smart Dashboard has been configured and will restart shortly.</p>
-            <p>The device will now connect to your WiFi network and start fetching images from GitHub.</p>
-        </div>
-        
-        <div class="info-section">
-            <h2>What happens next?</h2>
-            <ul>
-                <li>Device will restart and connect to your WiFi</li>
-                <li>First image will be downloaded and displayed</li>
-                <li>Images will update automatically every hour</li>
-                <li>The configuration portal will no longer be available</li>
-            </ul>
-        </div>
-        
-        <p class="note">If the device doesn't connect to WiFi, it will return to configuration mode after a few minutes.</p>
-    </div>
-    
-    <script>
-        setTimeout(function() {
-            document.body.innerHTML = '<div class="container"><h1>Device Restarting...</h1><p>Please wait while the device restarts and connects to your WiFi network.</p></div>';
-        }, 3000);
-    </script>
-</body>
-</html>
-)HTML";
-}
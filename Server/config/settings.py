@@ -56,6 +56,11 @@ class DisplayConfig:
     # Overlay styling
     TEXT_COLOR = (0, 0, 0)                    # Pure black text
     OVERLAY_BACKGROUND = (255, 255, 255)      # White background for overlays
+    
+    # Band of the overlay box the firmware draws itself (portrait x, y, width, height).
+    # Keep in sync with OVERLAY_BAND_* in Firmware/include/weather_overlay.h
+    DEVICE_OVERLAY_BAND = (82, 694, 316, 72)
+    DEVICE_ICON_SIZE = 64
 
 
 
@@ -259,6 +259,23 @@ class GeolocationProvider:
             time_str = utc_time.strftime("%H:%M")
             return date_str, time_str
 
+    def get_utc_offset_seconds(self, timezone_name: str) -> int:
+        """
+        Get the current UTC offset of a timezone, including daylight saving time.
+        
+        Args:
+            timezone_name: Timezone name (e.g., 'Europe/Vienna')
+            
+        Returns:
+            Offset in seconds (0 if the timezone is unknown)
+        """
+        try:
+            offset = datetime.now(pytz.timezone(timezone_name)).utcoffset()
+            return int(offset.total_seconds()) if offset else 0
+        except Exception as e:
+            print(f"⚠️  Could not get UTC offset for {timezone_name}: {e}")
+            return 0
+
     def list_cached_locations(self) -> Dict:
         """
         Get all cached locations.
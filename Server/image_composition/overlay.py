@@ -5,10 +5,15 @@ Overlay Composer for Smart Dashboard Server.
 Handles creating information overlays on map images with weather, time, and location data.
 """
 
+import json
+import os
+import time
+import zlib
 from PIL import Image, ImageDraw
 from typing import Optional, Dict, Tuple
 from .fonts import FontManager
-from config.settings import FontConfig
+from config.settings import FontConfig, DisplayConfig
+from utils.frame_codec import GENERATION_PERIOD_S
 
 
 class OverlayComposer:
@@ -47,9 +52,13 @@ class OverlayComposer:
     
     def add_info_overlay(self, image: Image.Image, city: str, country: str, 
                         lat: float, lng: float, date_str: str, time_str: str,
-                        weather_data: Optional[Dict] = None, weather_icon: Optional[Image.Image] = None) -> Image.Image:
+                        weather_data: Optional[Dict] = None, weather_icon: Optional[Image.Image] = None,
+                        include_dynamic: bool = True) -> Image.Image:
         """
         Add information overlay with solid white background and rounded corners ON TOP of the map.
+        
+        Without the dynamic part (date, time and weather) the device band is left
+        blank; this is the base frame the firmware draws its own weather onto.
 
         Args:
             image: Base map image
@@ -61,6 +70,7 @@ class OverlayComposer:
             time_str: Formatted time string
             weather_data: Weather information dictionary
             weather_icon: Weather icon image (PIL Image)
+            include_dynamic: Draw date, time and weather (False for the base frame)
 
         Returns:
             Image with overlay ON TOP
@@ -134,6 +144,12 @@ class OverlayComposer:
         text_x = x + (overlay_width - text_width) // 2
         draw.text((text_x, text_y_base + 35), coord_text, fill=coord_color, font=coord_font)  # Increased spacing
 
+        if not include_dynamic:
+            band_x, band_y, band_w, band_h = DisplayConfig.DEVICE_OVERLAY_BAND
+            draw.rectangle([band_x, band_y, band_x + band_w - 1, band_y + band_h - 1],
+                           fill=DisplayConfig.OVERLAY_BACKGROUND)
+            return image
+
         # Weather and datetime information (bottom section) - properly aligned groups
         if weather_data:
             temp_text = f"{weather_data['temperature']}°C"
@@ -240,6 +256,43 @@ class OverlayComposer:
 
         return image
     
+    def write_device_overlay(self, json_path: str, base_bin_path: str, weather_data: Optional[Dict],
+                             utc_offset: int) -> Optional[str]:
+        """
+        Write the data the firmware needs to draw the dynamic overlay itself.
+        
+        Args:
+            json_path: Output path (<name>.weather.json)
+            base_bin_path: Base frame the overlay is drawn onto
+            weather_data: Weather information dictionary, or None
+            utc_offset: Local time offset in seconds for the on-device clock
+            
+        Returns:
+            str: Path to the written file, or None if there is no base frame
+        """
+        if not base_bin_path or not os.path.exists(base_bin_path):
+            return None
+        
+        with open(base_bin_path, 'rb') as f:
+            base_hash = zlib.crc32(f.read()) & 0xFFFFFFFF
+        
+        now = int(time.time())
+        data = {
+            'version': 1,
+            'base': f"{base_hash:08x}",
+            'utc_offset': int(utc_offset),
+            'temperature': weather_data['temperature'] if weather_data else None,
+            'icon': weather_data['icon'] if weather_data else None,
+            'generated': now,
+            'next_update': (now // GENERATION_PERIOD_S + 1) * GENERATION_PERIOD_S,
+        }
+        
+        with open(json_path, 'w') as f:
+            json.dump(data, f, separators=(',', ':'))
+        
+        print(f"✅ Device overlay data saved to: {json_path} ({os.path.getsize(json_path)} bytes)")
+        return json_path
+    
     def crop_to_final_size(self, image: Image.Image) -> Image.Image:
         """
         Crop square image to final size from center.
@@ -217,6 +217,20 @@ class MapGenerator:
             # Generate C array and binary files for e-paper display
             c_path, bin_path = self.epaper_converter.convert_png_to_epaper(save_path)
             
+            # Base frame without date, time and weather, plus the data the
+            # firmware needs to draw them itself - the base rarely changes
+            base_image = self.overlay_composer.crop_to_final_size(square_image)
+            base_image = self.overlay_composer.add_info_overlay(
+                base_image, city, country, lat, lng, date_str, time_str, include_dynamic=False
+            )
+            base_path = os.path.splitext(save_path)[0] + '_base.png'
+            base_image.save(base_path, 'PNG', optimize=True)
+            _, base_bin_path = self.epaper_converter.convert_png_to_epaper(base_path)
+            self.overlay_composer.write_device_overlay(
+                os.path.splitext(save_path)[0] + '.weather.json', base_bin_path, weather_data,
+                self.geolocation_provider.get_utc_offset_seconds(timezone_name)
+            )
+            
             # Generate e-paper visualization PNG
             if bin_path and os.path.exists(bin_path):
                 # Create visualization filename: City_Country_epd.png
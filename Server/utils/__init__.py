@@ -5,11 +5,14 @@ This package contains utility modules:
 - file_converter: E-paper format conversion utilities
 - png_to_epaper_converter: Direct PNG to e-paper conversion
 - epaper_visualizer: E-paper binary to PNG conversion for visualization
+- frame_codec: Compressed frame container downloaded by the firmware
 """
 
 from .file_converter import EpaperConverter
 from .png_to_epaper_converter import convert_png_to_c_file, convert_png_to_bin_only, EpaperColorConverter
 from .epaper_visualizer import visualize_epaper_binary, analyze_epaper_binary, EpaperVisualizer
+from .frame_codec import FrameCodec, write_frame_container, write_delta_container, write_tile_pack, write_manifest
 
 __all__ = ['EpaperConverter', 'convert_png_to_c_file', 'convert_png_to_bin_only', 'EpaperColorConverter', 
-           'visualize_epaper_binary', 'analyze_epaper_binary', 'EpaperVisualizer']
+           'visualize_epaper_binary', 'analyze_epaper_binary', 'EpaperVisualizer',
+           'FrameCodec', 'write_frame_container', 'write_delta_container', 'write_tile_pack', 'write_manifest']
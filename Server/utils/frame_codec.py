@@ -0,0 +1,516 @@
+#!/usr/bin/env python3
+"""
+Compressed Frame Container for Smart Dashboard Server.
+
+Wraps a packed 4bpp e-paper frame in a small header so the firmware can
+validate and decode it incrementally while it is still downloading.
+
+Container layout (little-endian, 24-byte header followed by the payload):
+
+    offset  type  field
+    0       4s    magic         b'EPDF'
+    4       B     version       1
+    5       B     codec         0 = raw, 1 = RLE, 2 = zlib (4 KB window)
+    6       B     pixel format  0 = packed 4bpp palette indices
+    7       B     flags         bit 0 = delta payload (see below)
+    8       H     width         pixels
+    10      H     height        pixels
+    12      I     raw size      decoded payload size in bytes
+    16      I     payload size  encoded bytes following the header
+    20      I     crc32         CRC-32 (zlib.crc32) of the decoded payload
+
+RLE codec: a control byte c is followed by either c + 1 literal bytes
+(c < 0x80) or one byte repeated (c & 0x7F) + 3 times (c >= 0x80).
+
+The zlib codec is limited to a 4 KB window so the firmware's inflater
+only needs a 4 KB ring buffer instead of the default 32 KB.
+
+Delta payload (flag bit 0): instead of a whole frame, the decoded payload
+patches the previously published frame. It starts with a 16-byte header
+(b'EPDD', base crc32, target crc32, rectangle count, reserved), followed
+by each rectangle (x, y, width, height as uint16, x and width even) and
+its rows of packed pixels. Rectangles are sorted by y and never share a
+row, so the firmware patches its cached frame in a single pass.
+
+Manifest (<name>.manifest.json): a few hundred bytes the firmware fetches
+before anything else. It names the CRC-32 of the current frame, so an
+unchanged frame costs no download at all, the base a delta applies to,
+and when the next generation is due, so the device can sleep until then.
+
+Tiled frame (<name>.tiles.idx + <name>.tiles.pak): the frame cut into
+80x80 tiles in row-major order. The pack holds every distinct tile once
+as an 80x80 container; the index (12-byte header b'EPTI', version,
+tile size, columns, rows, frame crc32, then crc32, offset and length of
+each tile's container) lets the firmware build the frame from tiles it
+has cached and fetch only the missing ones with Range requests.
+"""
+
+import json
+import os
+import struct
+import time
+import zlib
+
+# Seconds between generations - '*/10 * * * *' in .github/workflows/generate-maps.yml
+GENERATION_PERIOD_S = int(os.getenv('GENERATION_PERIOD_S', '600'))
+MANIFEST_VERSION = 1
+
+TILE_SIZE = 80              # TILE_SIZE in firmware frame_format.h
+TILE_INDEX_MAGIC = b'EPTI'
+TILE_INDEX_VERSION = 1
+TILE_INDEX_HEADER_FORMAT = '<4sBBBBI'
+TILE_INDEX_ENTRY_FORMAT = '<III'
+
+
+class FrameCodec:
+    """Encodes and decodes the compressed e-paper frame container"""
+    
+    MAGIC = b'EPDF'
+    VERSION = 1
+    HEADER_FORMAT = '<4sBBBBHHIII'
+    HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+    
+    CODEC_RAW = 0
+    CODEC_RLE = 1
+    CODEC_ZLIB = 2
+    CODEC_NAMES = {CODEC_RAW: 'raw', CODEC_RLE: 'rle', CODEC_ZLIB: 'zlib'}
+    
+    PIXEL_FORMAT_4BPP = 0
+    
+    FLAG_DELTA = 0x01
+    DELTA_MAGIC = b'EPDD'
+    DELTA_HEADER_FORMAT = '<4sIIHH'
+    DELTA_HEADER_SIZE = struct.calcsize(DELTA_HEADER_FORMAT)
+    DELTA_RECT_FORMAT = '<HHHH'
+    DELTA_RECT_SIZE = struct.calcsize(DELTA_RECT_FORMAT)
+    DELTA_MERGE_ROWS = 8  # Unchanged rows absorbed into a rectangle rather than splitting it
+    
+    ZLIB_WINDOW_BITS = 12  # 4 KB window - must match FRAME_INFLATE_WINDOW in firmware
+    
+    RLE_MIN_RUN = 3
+    RLE_MAX_RUN = 0x7F + RLE_MIN_RUN
+    RLE_MAX_LITERAL = 0x80
+    
+    @classmethod
+    def rle_encode(cls, data: bytes) -> bytes:
+        """Encode bytes with the container's run-length scheme."""
+        out = bytearray()
+        literal_start = 0
+        i = 0
+        length = len(data)
+        
+        def flush_literals(end):
+            start = literal_start
+            while start < end:
+                chunk = min(cls.RLE_MAX_LITERAL, end - start)
+                out.append(chunk - 1)
+                out.extend(data[start:start + chunk])
+                start += chunk
+        
+        while i < length:
+            run_end = i + 1
+            while run_end < length and data[run_end] == data[i] and run_end - i < cls.RLE_MAX_RUN:
+                run_end += 1
+            
+            if run_end - i >= cls.RLE_MIN_RUN:
+                flush_literals(i)
+                out.append(0x80 | (run_end - i - cls.RLE_MIN_RUN))
+                out.append(data[i])
+                i = run_end
+                literal_start = i
+            else:
+                i = run_end
+        
+        flush_literals(length)
+        return bytes(out)
+    
+    @classmethod
+    def rle_decode(cls, data: bytes) -> bytes:
+        """Decode the container's run-length scheme."""
+        out = bytearray()
+        i = 0
+        while i < len(data):
+            control = data[i]
+            i += 1
+            if control < 0x80:
+                out.extend(data[i:i + control + 1])
+                i += control + 1
+            else:
+                out.extend(bytes([data[i]]) * ((control & 0x7F) + cls.RLE_MIN_RUN))
+                i += 1
+        return bytes(out)
+    
+    @classmethod
+    def zlib_encode(cls, data: bytes) -> bytes:
+        """Compress with zlib using the small window the firmware supports."""
+        compressor = zlib.compressobj(9, zlib.DEFLATED, cls.ZLIB_WINDOW_BITS, 9)
+        return compressor.compress(data) + compressor.flush()
+    
+    @classmethod
+    def encode(cls, raw: bytes, width: int, height: int, codec: int = None, flags: int = 0) -> bytes:
+        """
+        Build a frame container around a packed 4bpp frame.
+        
+        Args:
+            raw: Packed frame data (2 pixels per byte), or a delta payload
+            width: Frame width in pixels
+            height: Frame height in pixels
+            codec: Codec to use; None picks the smallest encoding
+            flags: FLAG_DELTA when raw is a delta payload
+            
+        Returns:
+            bytes: Header followed by the encoded payload
+        """
+        candidates = {
+            cls.CODEC_RAW: lambda: raw,
+            cls.CODEC_RLE: lambda: cls.rle_encode(raw),
+            cls.CODEC_ZLIB: lambda: cls.zlib_encode(raw),
+        }
+        
+        if codec is None:
+            encoded = {c: encode() for c, encode in candidates.items()}
+            codec = min(encoded, key=lambda c: len(encoded[c]))
+            payload = encoded[codec]
+        else:
+            payload = candidates[codec]()
+        
+        header = struct.pack(cls.HEADER_FORMAT, cls.MAGIC, cls.VERSION, codec,
+                             cls.PIXEL_FORMAT_4BPP, flags, width, height,
+                             len(raw), len(payload), zlib.crc32(raw) & 0xFFFFFFFF)
+        return header + payload
+    
+    @classmethod
+    def decode(cls, container: bytes) -> tuple[dict, bytes]:
+        """
+        Parse and decode a frame container.
+        
+        Returns:
+            Tuple of (header dictionary, decoded frame bytes)
+            
+        Raises:
+            ValueError: If the container is malformed or fails its CRC check
+        """
+        if len(container) < cls.HEADER_SIZE:
+            raise ValueError("Frame container too short")
+        
+        fields = struct.unpack(cls.HEADER_FORMAT, container[:cls.HEADER_SIZE])
+        header = dict(zip(('magic', 'version', 'codec', 'pixel_format', 'flags', 'width',
+                           'height', 'raw_size', 'payload_size', 'crc32'), fields))
+        
+        if header['magic'] != cls.MAGIC or header['version'] != cls.VERSION:
+            raise ValueError("Not a frame container")
+        
+        payload = container[cls.HEADER_SIZE:cls.HEADER_SIZE + header['payload_size']]
+        if header['codec'] == cls.CODEC_RAW:
+            raw = payload
+        elif header['codec'] == cls.CODEC_RLE:
+            raw = cls.rle_decode(payload)
+        elif header['codec'] == cls.CODEC_ZLIB:
+            raw = zlib.decompress(payload)
+        else:
+            raise ValueError(f"Unknown codec {header['codec']}")
+        
+        if len(raw) != header['raw_size'] or (zlib.crc32(raw) & 0xFFFFFFFF) != header['crc32']:
+            raise ValueError("Frame container failed its integrity check")
+        
+        return header, raw
+    
+    @classmethod
+    def diff_regions(cls, base: bytes, target: bytes, width: int, height: int) -> list:
+        """
+        Find the changed regions between two packed frames.
+        
+        Consecutive changed rows (allowing DELTA_MERGE_ROWS unchanged rows in
+        between) form one band, and each band becomes the rectangle bounding
+        its changed bytes. Bands never share a row, as the firmware requires.
+        
+        Returns:
+            list: (x, y, width, height) tuples in pixels, sorted by y
+        """
+        row_bytes = width // 2
+        regions = []
+        band = None  # [first_row, last_row, first_byte, last_byte]
+        
+        for y in range(height):
+            start = y * row_bytes
+            base_row = base[start:start + row_bytes]
+            target_row = target[start:start + row_bytes]
+            if base_row == target_row:
+                continue
+            
+            changed = [i for i in range(row_bytes) if base_row[i] != target_row[i]]
+            if band and y - band[1] <= cls.DELTA_MERGE_ROWS + 1:
+                band[1] = y
+                band[2] = min(band[2], changed[0])
+                band[3] = max(band[3], changed[-1])
+            else:
+                if band:
+                    regions.append(band)
+                band = [y, y, changed[0], changed[-1]]
+        
+        if band:
+            regions.append(band)
+        
+        return [(first_byte * 2, first_row, (last_byte - first_byte + 1) * 2, last_row - first_row + 1)
+                for first_row, last_row, first_byte, last_byte in regions]
+    
+    @classmethod
+    def encode_delta_payload(cls, base: bytes, target: bytes, width: int, height: int) -> bytes:
+        """Build the delta payload that turns base into target."""
+        row_bytes = width // 2
+        regions = cls.diff_regions(base, target, width, height)
+        
+        out = bytearray(struct.pack(cls.DELTA_HEADER_FORMAT, cls.DELTA_MAGIC,
+                                    zlib.crc32(base) & 0xFFFFFFFF,
+                                    zlib.crc32(target) & 0xFFFFFFFF, len(regions), 0))
+        for x, y, w, h in regions:
+            out.extend(struct.pack(cls.DELTA_RECT_FORMAT, x, y, w, h))
+            for row in range(y, y + h):
+                start = row * row_bytes + x // 2
+                out.extend(target[start:start + w // 2])
+        return bytes(out)
+    
+    @classmethod
+    def apply_delta_payload(cls, base: bytes, payload: bytes, width: int) -> bytes:
+        """
+        Apply a delta payload to its base frame.
+        
+        Raises:
+            ValueError: If the payload does not belong to this base frame
+        """
+        magic, base_crc, target_crc, count, _ = struct.unpack(
+            cls.DELTA_HEADER_FORMAT, payload[:cls.DELTA_HEADER_SIZE])
+        if magic != cls.DELTA_MAGIC or base_crc != zlib.crc32(base) & 0xFFFFFFFF:
+            raise ValueError("Delta does not apply to this base frame")
+        
+        row_bytes = width // 2
+        frame = bytearray(base)
+        offset = cls.DELTA_HEADER_SIZE
+        for _ in range(count):
+            x, y, w, h = struct.unpack(cls.DELTA_RECT_FORMAT,
+                                       payload[offset:offset + cls.DELTA_RECT_SIZE])
+            offset += cls.DELTA_RECT_SIZE
+            for row in range(y, y + h):
+                start = row * row_bytes + x // 2
+                frame[start:start + w // 2] = payload[offset:offset + w // 2]
+                offset += w // 2
+        
+        if zlib.crc32(frame) & 0xFFFFFFFF != target_crc:
+            raise ValueError("Patched frame failed its integrity check")
+        return bytes(frame)
+
+
+def write_frame_container(bin_path: str, raw: bytes, width: int, height: int) -> str:
+    """
+    Write the compressed container next to a binary e-paper file.
+    
+    Args:
+        bin_path: Path of the raw .bin file (the container uses the .epf extension)
+        raw: Packed frame data
+        width: Frame width in pixels
+        height: Frame height in pixels
+        
+    Returns:
+        str: Path to the generated .epf file
+    """
+    epf_path = os.path.splitext(bin_path)[0] + '.epf'
+    container = FrameCodec.encode(bytes(raw), width, height)
+    
+    with open(epf_path, 'wb') as f:
+        f.write(container)
+    
+    codec = FrameCodec.CODEC_NAMES[container[5]]
+    ratio = len(raw) / len(container)
+    print(f"✅ Compressed frame saved to: {epf_path} ({len(container)} bytes, {codec}, {ratio:.1f}x)")
+    return epf_path
+
+
+def write_delta_container(bin_path: str, base: bytes, raw: bytes, width: int, height: int):
+    """
+    Write the delta container that patches the previous frame into the new one.
+    
+    The delta is only kept when it is smaller than the full container; a
+    stale delta is removed so the firmware falls back to the full frame.
+    
+    Args:
+        bin_path: Path of the raw .bin file (the delta uses the .delta.epf extension)
+        base: Previously published frame, or None if there is none
+        raw: New packed frame data
+        width: Frame width in pixels
+        height: Frame height in pixels
+        
+    Returns:
+        str: Path to the generated .delta.epf file, or None if no delta was written
+    """
+    stem = os.path.splitext(bin_path)[0]
+    delta_path = stem + '.delta.epf'
+    
+    container = None
+    if base is not None and len(base) == len(raw):
+        payload = FrameCodec.encode_delta_payload(bytes(base), bytes(raw), width, height)
+        container = FrameCodec.encode(payload, width, height, flags=FrameCodec.FLAG_DELTA)
+        
+        full_path = stem + '.epf'
+        if os.path.exists(full_path) and len(container) >= os.path.getsize(full_path):
+            container = None
+    
+    if container is None:
+        if os.path.exists(delta_path):
+            os.remove(delta_path)
+        print("ℹ️  No delta frame written (no previous frame or delta not smaller)")
+        return None
+    
+    with open(delta_path, 'wb') as f:
+        f.write(container)
+    
+    rect_count = struct.unpack_from('<H', payload, 12)[0]
+    print(f"✅ Delta frame saved to: {delta_path} ({len(container)} bytes, {rect_count} regions)")
+    return delta_path
+
+
+def write_tile_pack(bin_path: str, raw: bytes, width: int, height: int):
+    """
+    Write the tile index and pack of a frame.
+    
+    Tiles are identified by the CRC-32 of their pixels, so a tile repeated
+    in the frame (sea, empty background) is stored once, and a device keeps
+    the tiles it already has when the map moves or an overlay changes.
+    
+    Args:
+        bin_path: Path of the raw .bin file (uses the .tiles.idx and .tiles.pak extensions)
+        raw: Packed frame data
+        width: Frame width in pixels
+        height: Frame height in pixels
+        
+    Returns:
+        str: Path to the generated .tiles.idx file, or None if the frame does not tile
+    """
+    stem = os.path.splitext(bin_path)[0]
+    index_path = stem + '.tiles.idx'
+    pack_path = stem + '.tiles.pak'
+    
+    if width % TILE_SIZE or height % TILE_SIZE:
+        for path in (index_path, pack_path):
+            if os.path.exists(path):
+                os.remove(path)
+        print(f"ℹ️  No tiles written ({width}x{height} is not a multiple of {TILE_SIZE})")
+        return None
+    
+    columns = width // TILE_SIZE
+    rows = height // TILE_SIZE
+    row_bytes = width // 2
+    tile_row_bytes = TILE_SIZE // 2
+    
+    pack = bytearray()
+    entries = []
+    stored = {}
+    for row in range(rows):
+        for column in range(columns):
+            tile = b''.join(
+                raw[(row * TILE_SIZE + y) * row_bytes + column * tile_row_bytes:][:tile_row_bytes]
+                for y in range(TILE_SIZE))
+            crc = zlib.crc32(tile) & 0xFFFFFFFF
+            if crc not in stored:
+                container = FrameCodec.encode(tile, TILE_SIZE, TILE_SIZE)
+                stored[crc] = (len(pack), len(container))
+                pack += container
+            entries.append(struct.pack(TILE_INDEX_ENTRY_FORMAT, crc, *stored[crc]))
+    
+    header = struct.pack(TILE_INDEX_HEADER_FORMAT, TILE_INDEX_MAGIC, TILE_INDEX_VERSION, TILE_SIZE,
+                         columns, rows, zlib.crc32(bytes(raw)) & 0xFFFFFFFF)
+    
+    # The pack first, so a device never finds an index pointing past its end
+    with open(pack_path, 'wb') as f:
+        f.write(pack)
+    with open(index_path, 'wb') as f:
+        f.write(header + b''.join(entries))
+    
+    print(f"✅ Tiles saved to: {pack_path} ({len(stored)}/{len(entries)} distinct, {len(pack)} bytes)")
+    return index_path
+
+
+def write_manifest(bin_path: str, raw: bytes, width: int, height: int, delta_base: bytes = None,
+                   period_s: int = GENERATION_PERIOD_S) -> str:
+    """
+    Write the manifest describing the published frame and its delta.
+    
+    Args:
+        bin_path: Path of the raw .bin file (the manifest uses the .manifest.json extension)
+        raw: Packed frame data that was just published
+        width: Frame width in pixels
+        height: Frame height in pixels
+        delta_base: Frame the .delta.epf patches, or None if no delta was written
+        period_s: Seconds until the next scheduled generation
+        
+    Returns:
+        str: Path to the generated .manifest.json file
+    """
+    stem = os.path.splitext(bin_path)[0]
+    manifest_path = stem + '.manifest.json'
+    epf_path = stem + '.epf'
+    delta_path = stem + '.delta.epf'
+    pack_path = stem + '.tiles.pak'
+    
+    with open(epf_path, 'rb') as f:
+        codec = FrameCodec.CODEC_NAMES.get(f.read(FrameCodec.HEADER_SIZE)[5], 'unknown')
+    
+    # Aligned to the cron slots, not to when this run happened to finish
+    now = int(time.time())
+    manifest = {
+        'version': MANIFEST_VERSION,
+        'hash': f"{zlib.crc32(bytes(raw)) & 0xFFFFFFFF:08x}",
+        'size': os.path.getsize(epf_path),
+        'codec': codec,
+        'width': width,
+        'height': height,
+        'generated': now,
+        'next_update': (now // period_s + 1) * period_s,
+        'delta': None,
+        'tiles': None,
+    }
+    
+    if delta_base is not None and os.path.exists(delta_path):
+        manifest['delta'] = {
+            'base': f"{zlib.crc32(bytes(delta_base)) & 0xFFFFFFFF:08x}",
+            'size': os.path.getsize(delta_path),
+        }
+    
+    if os.path.exists(pack_path):
+        manifest['tiles'] = {
+            'size': os.path.getsize(pack_path),
+        }
+    
+    with open(manifest_path, 'w') as f:
+        json.dump(manifest, f, separators=(',', ':'))
+    
+    print(f"✅ Manifest saved to: {manifest_path} (hash {manifest['hash']}, "
+          f"next update {time.strftime('%H:%M:%S', time.gmtime(manifest['next_update']))} UTC)")
+    return manifest_path
+
+
+# Test when run directly
+if __name__ == "__main__":
+    import sys
+    
+    bin_file = sys.argv[1] if len(sys.argv) > 1 else 'Maps/Vienna_Austria.bin'
+    with open(bin_file, 'rb') as f:
+        frame = f.read()
+    
+    for codec_id, name in FrameCodec.CODEC_NAMES.items():
+        container = FrameCodec.encode(frame, 800, 480, codec_id)
+        header, decoded = FrameCodec.decode(container)
+        status = "✅" if decoded == frame else "❌"
+        print(f"{status} {name}: {len(container)} bytes ({len(frame) / len(container):.2f}x)")
+    
+    # Delta against a copy with a repainted box, like a weather overlay update
+    changed = bytearray(frame)
+    for row in range(40, 120):
+        changed[row * 400 + 300:row * 400 + 380] = bytes([0x11]) * 80
+    changed = bytes(changed)
+    payload = FrameCodec.encode_delta_payload(frame, changed, 800, 480)
+    container = FrameCodec.encode(payload, 800, 480, flags=FrameCodec.FLAG_DELTA)
+    header, decoded = FrameCodec.decode(container)
+    patched = FrameCodec.apply_delta_payload(frame, decoded, 800)
+    status = "✅" if patched == changed and header['flags'] == FrameCodec.FLAG_DELTA else "❌"
+    print(f"{status} delta: {len(container)} bytes, "
+          f"{len(FrameCodec.diff_regions(frame, changed, 800, 480))} regions")
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Palette LUT Generator for the ESP32-S2 Smart Dashboard firmware.
+
+Precomputes the nearest e-paper color for every 15-bit RGB value (5 bits per
+channel, 32768 entries) so the firmware's ColorQuantizer can map a pixel to
+the palette with a single table lookup instead of seven distance checks.
+The palette is the one png_to_epaper_converter dithers against, so frames
+converted on the device match the server's colors.
+
+Usage (from the Server directory):
+    python utils/palette_lut_generator.py [output_header]
+"""
+
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from utils.png_to_epaper_converter import EpaperColorConverter  # noqa: E402
+
+DEFAULT_OUTPUT = os.path.join('..', 'Firmware', 'include', 'palette_lut.h')
+
+# Index 7 is the afterimage "clean" color - not a displayable ink
+PANEL_COLORS = 7
+
+
+def expand5(value: int) -> int:
+    """Scale a 5-bit channel back to 8 bits, replicating the top bits."""
+    return (value << 3) | (value >> 2)
+
+
+def closest_color(rgb) -> int:
+    """Nearest palette entry by squared Euclidean distance, like find_closest_color."""
+    palette = EpaperColorConverter.PALETTE[:PANEL_COLORS]
+    return min(range(PANEL_COLORS),
+               key=lambda i: sum((palette[i][c] - rgb[c]) ** 2 for c in range(3)))
+
+
+def c_bytes(data, indent: str = '    ') -> str:
+    lines = []
+    for i in range(0, len(data), 32):
+        lines.append(indent + ','.join(str(b) for b in data[i:i + 32]) + ',')
+    return '\n'.join(lines)
+
+
+def generate_header(output_path: str) -> str:
+    lut = bytearray(32768)
+    for index in range(32768):
+        rgb = (expand5(index >> 10), expand5((index >> 5) & 0x1F), expand5(index & 0x1F))
+        lut[index] = closest_color(rgb)
+
+    palette = EpaperColorConverter.PALETTE[:PANEL_COLORS]
+    out = [
+        '// Generated by Server/utils/palette_lut_generator.py - do not edit',
+        '#ifndef PALETTE_LUT_H',
+        '#define PALETTE_LUT_H',
+        '',
+        '#include <stdint.h>',
+        '',
+        f'#define PALETTE_COLORS {PANEL_COLORS}',
+        '',
+        '// RGB of each panel color, indexed like EPD_7IN3F_*',
+        'static constexpr uint8_t PALETTE_RGB[PALETTE_COLORS][3] = {',
+    ]
+    for r, g, b in palette:
+        out.append(f'    {{ {r}, {g}, {b} }},')
+    out.append('};')
+    out.append('')
+    out.append('// Nearest panel color for each RGB555 value: index = r5 << 10 | g5 << 5 | b5')
+    out.append('static constexpr uint8_t PALETTE_LUT[32768] = {')
+    out.append(c_bytes(lut))
+    out.append('};')
+    out.append('')
+    out.append('#endif // PALETTE_LUT_H')
+
+    with open(output_path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    print(f"✅ Palette LUT saved to: {output_path}")
+    return output_path
+
+
+if __name__ == "__main__":
+    generate_header(sys.argv[1] if len(sys.argv) > 1 else DEFAULT_OUTPUT)
@@ -8,6 +8,11 @@ import numpy as np
 from PIL import Image
 import os
 
+try:
+    from .frame_codec import write_frame_container, write_delta_container, write_tile_pack, write_manifest
+except ImportError:  # Run directly as a script
+    from frame_codec import write_frame_container, write_delta_container, write_tile_pack, write_manifest
+
 
 class EpaperColorConverter:
     """Converts PNG images to 7-color e-paper C array format with Floyd-Steinberg dithering"""
@@ -193,10 +198,26 @@ class EpaperColorConverter:
                     base_name = os.path.splitext(input_path)[0]
                     bin_path = f"{base_name}.bin"
                 
+                # The frame being replaced is the base for the delta frame
+                previous_frame = None
+                if os.path.exists(bin_path):
+                    with open(bin_path, 'rb') as f:
+                        previous_frame = f.read()
+                
                 with open(bin_path, 'wb') as f:
                     f.write(output_buffer)
                 print(f"✅ Binary file saved to: {bin_path}")
                 
+                # Compressed container next to it - this is what the firmware downloads
+                write_frame_container(bin_path, output_buffer, target_width, target_height)
+                delta_path = write_delta_container(bin_path, previous_frame, output_buffer,
+                                                   target_width, target_height)
+                write_tile_pack(bin_path, output_buffer, target_width, target_height)
+                
+                # Written last - the firmware reads it to decide what to download
+                write_manifest(bin_path, output_buffer, target_width, target_height,
+                               delta_base=previous_frame if delta_path else None)
+                
                 # Optionally generate C array code (for development/debugging)
                 if generate_c_file and output_path:
                     c_code = f"// 7 Color Image Data {target_width}*{target_height}\n"
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""
+Weather Sprite Generator for the ESP32-S2 Smart Dashboard firmware.
+
+Pre-renders everything the firmware needs to draw the weather overlay on
+the device: the Quicksand digits and letters used for date, time and
+temperature, and the weather icons from utils/icons. Sprites are packed 4bpp
+palette indices, already rotated into panel orientation like the frames
+produced by png_to_epaper_converter, and written as a C header that is
+compiled into flash.
+
+Usage (from the Server directory):
+    python utils/sprite_generator.py [output_header]
+"""
+
+import calendar
+import os
+import sys
+
+import numpy as np
+from PIL import Image, ImageDraw
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from config.settings import FontConfig, DisplayConfig, PathConfig  # noqa: E402
+from image_composition.fonts import FontManager  # noqa: E402
+from utils.png_to_epaper_converter import EpaperColorConverter  # noqa: E402
+
+DEFAULT_OUTPUT = os.path.join('..', 'Firmware', 'include', 'weather_sprites.h')
+
+BLACK = 0
+WHITE = 1
+
+# Characters each font has to cover - month names come from the C locale,
+# which is what strftime("%B") produces on the device
+MONTH_LETTERS = ''.join(sorted(set(''.join(calendar.month_name[1:])) - {' '}))
+SPRITE_FONTS = [
+    ('DATE', FontConfig.DATE_SIZE, '0123456789 ' + MONTH_LETTERS),
+    ('TIME', FontConfig.TIME_SIZE, '0123456789:'),
+    ('TEMP', FontConfig.TEMP_SIZE, '0123456789-°C'),
+]
+
+
+def pack_4bpp(indices: np.ndarray) -> bytes:
+    """Pack a 2D array of palette indices, two pixels per byte, rows padded to a byte."""
+    height, width = indices.shape
+    if width % 2:
+        indices = np.hstack([indices, np.full((height, 1), WHITE, dtype=indices.dtype)])
+    pairs = indices.reshape(height, -1, 2).astype(np.uint8)
+    return bytes((pairs[:, :, 0] << 4 | pairs[:, :, 1]).flatten())
+
+
+def to_panel(image: Image.Image) -> Image.Image:
+    """Rotate a portrait-oriented sprite into panel orientation."""
+    return image.rotate(-90, expand=True)
+
+
+def render_glyph(font, char: str, height: int):
+    """Render one character into a cell of the font's line height, black on white."""
+    advance = max(1, int(round(font.getlength(char))))
+    cell = Image.new('L', (advance, height), 0)
+    ImageDraw.Draw(cell).text((0, 0), char, fill=255, font=font)
+
+    # Hard threshold - anti-aliasing has no place on a 7-color panel
+    mask = np.array(to_panel(cell)) >= 128
+    return advance, np.where(mask, BLACK, WHITE)
+
+
+def render_icon(path: str, size: int, converter: EpaperColorConverter) -> np.ndarray:
+    """Scale an icon, flatten it onto the white overlay and dither it to the palette."""
+    icon = Image.open(path).convert('RGBA').resize((size, size), Image.Resampling.LANCZOS)
+    flat = Image.new('RGB', icon.size, DisplayConfig.OVERLAY_BACKGROUND)
+    flat.paste(icon, (0, 0), icon)
+
+    dithered = converter.apply_floyd_steinberg_dithering(np.array(to_panel(flat)))
+    height, width = dithered.shape[:2]
+    indices = np.zeros((height, width), dtype=np.uint8)
+    for y in range(height):
+        for x in range(width):
+            indices[y, x] = converter.find_closest_color(dithered[y, x])
+    return indices
+
+
+def c_bytes(data: bytes, indent: str = '    ') -> str:
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ', '.join(f'0x{b:02X}' for b in data[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def generate_header(output_path: str) -> str:
+    font_manager = FontManager(PathConfig.FONTS_FOLDER)
+    converter = EpaperColorConverter()
+    out = [
+        '// Generated by Server/utils/sprite_generator.py - do not edit',
+        '#ifndef WEATHER_SPRITES_H',
+        '#define WEATHER_SPRITES_H',
+        '',
+        '#include "sprite.h"',
+        '',
+    ]
+
+    for name, size, chars in SPRITE_FONTS:
+        font = font_manager.get_font(size)
+        ascent, descent = font.getmetrics()
+        height = ascent + descent
+        bitmaps = bytearray()
+        glyphs = []
+
+        for char in chars:
+            advance, indices = render_glyph(font, char, height)
+            glyphs.append((ord(char), advance, len(bitmaps)))
+            bitmaps += pack_4bpp(indices)
+
+        out.append(f'// Quicksand {size}px: {chars!r}')
+        out.append(f'static constexpr uint8_t SPRITE_FONT_{name}_BITMAPS[] = {{')
+        out.append(c_bytes(bitmaps))
+        out.append('};')
+        out.append(f'static constexpr SpriteGlyph SPRITE_FONT_{name}_GLYPHS[] = {{')
+        for code, advance, offset in glyphs:
+            out.append(f'    {{ 0x{code:02X}, {advance}, {offset} }},')
+        out.append('};')
+        out.append(f'static constexpr SpriteFont SPRITE_FONT_{name} = '
+                   f'{{ {height}, {len(glyphs)}, SPRITE_FONT_{name}_GLYPHS, SPRITE_FONT_{name}_BITMAPS }};')
+        out.append('')
+        print(f"✅ Font {name}: {len(glyphs)} glyphs, {height}px, {len(bitmaps)} bytes")
+
+    icon_size = DisplayConfig.DEVICE_ICON_SIZE
+    icon_codes = sorted(os.path.splitext(f)[0] for f in os.listdir(PathConfig.WEATHER_ICONS_FOLDER)
+                        if f.endswith('.png'))
+    out.append(f'#define WEATHER_ICON_SIZE {icon_size}')
+    out.append('')
+    for code in icon_codes:
+        indices = render_icon(os.path.join(PathConfig.WEATHER_ICONS_FOLDER, f'{code}.png'), icon_size, converter)
+        out.append(f'static constexpr uint8_t WEATHER_ICON_{code.upper()}[] = {{')
+        out.append(c_bytes(pack_4bpp(indices)))
+        out.append('};')
+    out.append('')
+    out.append('static constexpr WeatherIconSprite WEATHER_ICONS[] = {')
+    for code in icon_codes:
+        out.append(f'    {{ "{code}", WEATHER_ICON_{code.upper()} }},')
+    out.append('};')
+    out.append(f'#define WEATHER_ICON_COUNT {len(icon_codes)}')
+    out.append('')
+    out.append('#endif // WEATHER_SPRITES_H')
+    print(f"✅ Icons: {len(icon_codes)} x {icon_size}x{icon_size}")
+
+    with open(output_path, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+    print(f"✅ Sprites saved to: {output_path}")
+    return output_path
+
+
+if __name__ == "__main__":
+    generate_header(sys.argv[1] if len(sys.argv) > 1 else DEFAULT_OUTPUT)